@@ -20,7 +20,7 @@ LOCAL_STATIC_LIBRARIES := v8_base v8_snapshot
 LOCAL_C_INCLUDES := $(LOCAL_PATH)/include
 
 LOCAL_MODULE := hypercasino
-LOCAL_SRC_FILES := main.cpp Configuration.cpp Wrappable.cpp Event.cpp V8Event.cpp
+LOCAL_SRC_FILES := main.cpp Configuration.cpp PerIsolateData.cpp AtomTable.cpp ScriptCache.cpp MicrotaskScheduler.cpp SlabAllocator.cpp PoolingArrayBufferAllocator.cpp Wrappable.cpp HeapTracer.cpp ExternalMemory.cpp GcMetrics.cpp Event.cpp V8Event.cpp EventTarget.cpp V8EventTarget.cpp EventQueue.cpp CodeCache.cpp StreamingScriptLoader.cpp MappedScriptSource.cpp ModuleLoader.cpp Environment.cpp Snapshot.cpp IsolatePool.cpp ContextPool.cpp TaskPlatform.cpp Benchmarks.cpp
 LOCAL_LDLIBS := -llog -lGLESv2 -landroid
 
 include $(BUILD_SHARED_LIBRARY)
@@ -0,0 +1,36 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include "AtomTable.h"
+
+using namespace v8;
+
+Config::AtomTable::~AtomTable() {
+    for (auto& atom : atoms_) {
+        atom.second.Reset();
+        delete[] atom.first;
+    }
+}
+
+Local<String> Config::AtomTable::Get(const char* name) {
+
+    auto iter = atoms_.find(name);
+    if ( iter != atoms_.end() ) {
+        return (*iter).second.Get(isolate_);
+    }
+
+    size_t len = strlen(name);
+    Local<String> atom = String::NewFromUtf8(
+            isolate_, name, NewStringType::kInternalized, static_cast<int>(len)).ToLocalChecked();
+
+    if ( atoms_.size() >= kMaxAtoms ) {
+        return atom;
+    }
+
+    char* key = new char[len + 1];
+    memcpy(key, name, len + 1);
+    atoms_.insert(std::make_pair(key, Global<String>(isolate_, atom)));
+
+    return atom;
+}
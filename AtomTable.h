@@ -0,0 +1,64 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_ATOMTABLE_H
+#define HYPERCASINO_ATOMTABLE_H
+
+#include <cstring>
+#include <unordered_map>
+#include <v8.h>
+
+namespace Config {
+
+    /**
+     * Per isolate table of internalized strings for native names, like event types.
+     * Handles are released with the table, see PerIsolateData::Dispose.
+     * Getters return the same internalized handle for the same name, so no heap string is
+     * allocated per read and comparisons in javascript are pointer comparisons.
+     * Names can come from script, like event types, so the table holds at most kMaxAtoms. Names
+     * past that are still internalized, but not kept: v8 collects them when unused.
+     * Owned by PerIsolateData.
+     */
+    class AtomTable {
+    public:
+
+        static const size_t kMaxAtoms = 512;
+
+        explicit AtomTable(v8::Isolate *isolate) : isolate_(isolate) {}
+        ~AtomTable();
+
+        AtomTable(const AtomTable&) = delete;
+        AtomTable& operator=(const AtomTable&) = delete;
+
+        v8::Local<v8::String> Get(const char *name);
+
+        size_t Size() const { return atoms_.size(); }
+
+    private:
+
+        struct NameHash {
+            size_t operator()(const char *name) const {
+                // FNV-1a
+                size_t hash = 2166136261u;
+                for (; *name; name++) {
+                    hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+                }
+                return hash;
+            }
+        };
+
+        struct NameEqual {
+            bool operator()(const char *a, const char *b) const {
+                return strcmp(a, b) == 0;
+            }
+        };
+
+        v8::Isolate* isolate_;
+
+        // keys are owned copies of the names.
+        std::unordered_map<const char*, v8::Global<v8::String>, NameHash, NameEqual> atoms_;
+    };
+}
+
+#endif //HYPERCASINO_ATOMTABLE_H
@@ -0,0 +1,313 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <time.h>
+#include <stdio.h>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <main.h>
+#include "Benchmarks.h"
+#include "Event.h"
+#include "EventTarget.h"
+#include "PerIsolateData.h"
+#include "IsolatePool.h"
+#include "ContextPool.h"
+
+namespace BenchmarksInternal {
+
+    double NowMillis() {
+        struct timespec __now;
+        clock_gettime(CLOCK_MONOTONIC_RAW, &__now);
+        return __now.tv_sec * 1000.0 + __now.tv_nsec / 1000000.0;
+    }
+
+    void Report(const char* name, int count, double elapsed) {
+        LOGV("bench %s: %d ops in %.2fms, %.0f ops/sec",
+             name, count, elapsed, elapsed > 0 ? count * 1000.0 / elapsed : 0.0);
+    }
+
+    // how Wrappable::Wrap used to build wrappers: a constructor call per wrapper.
+    Local<Object> WrapWithConstructor(Isolate* isolate, Local<Context> context, Wrappable* ev) {
+
+        const WrapperTypeInfo* wrapper_type_info = ev->GetWrapperTypeInfo();
+
+        Local<Object> wrapper;
+        {
+            Config::ConstructorModeScope wrap_mode(isolate, Config::kWrapExistingObject);
+            wrapper = wrapper_type_info->
+                    template_function(isolate)->
+                    GetFunction(context).ToLocalChecked()->
+                    NewInstance(context).ToLocalChecked();
+        }
+
+        return ev->AssociateWithWrapper(isolate, wrapper_type_info, wrapper);
+    }
+
+    char benchTypeNames[Benchmarks::kBenchmarkTypeCount][16];
+
+    // a synthetic wrapper type. Indices start after the real ones.
+    template<int N>
+    struct BenchType {
+
+        static void InstallInterfaceTemplate(Isolate* isolate, Local<FunctionTemplate> interface_template) {
+            Config::InitializeInterfaceTemplate(isolate, interface_template, wrapperTypeInfo);
+        }
+
+        static Local<FunctionTemplate> InterfaceTemplate(Isolate* isolate) {
+            return Config::InterfaceTemplate(isolate, wrapperTypeInfo, InstallInterfaceTemplate);
+        }
+
+        static const WrapperTypeInfo wrapperTypeInfo;
+    };
+
+    template<int N>
+    const WrapperTypeInfo BenchType<N>::wrapperTypeInfo = {
+            BenchType<N>::InterfaceTemplate,
+            benchTypeNames[N],
+            nullptr,
+            2,
+            0,
+            static_cast<uint16_t>(Config::kWrapperTypeCount + N),
+            nullptr
+    };
+
+    template<int N>
+    struct BenchTypes {
+        static void Collect(const WrapperTypeInfo** types) {
+            BenchTypes<N - 1>::Collect(types);
+            types[N - 1] = &BenchType<N - 1>::wrapperTypeInfo;
+        }
+    };
+
+    template<>
+    struct BenchTypes<0> {
+        static void Collect(const WrapperTypeInfo** types) {}
+    };
+}
+
+void Benchmarks::Run(Isolate* isolate, Local<Context> context) {
+    Benchmarks::Wrap(isolate, context, 100000);
+    Benchmarks::InterfaceTemplateLookup(isolate, 1000000);
+    Benchmarks::WrapBatch(isolate, context, 2000, 50);
+    Benchmarks::Dispatch(isolate, context, 10000);
+    Benchmarks::IsolatePoolThroughput(2000);
+    Benchmarks::ContextAcquire(isolate, 200);
+    Benchmarks::ArrayBufferChurn(isolate, context, 100000);
+    Benchmarks::LogSlabStatistics();
+}
+
+void Benchmarks::Wrap(Isolate* isolate, Local<Context> context, int count) {
+
+    HandleScope hs(isolate);
+    Context::Scope context_scope(context);
+
+    double start = BenchmarksInternal::NowMillis();
+    for (int i = 0; i < count; i++) {
+        HandleScope inner(isolate);
+        BenchmarksInternal::WrapWithConstructor(isolate, context, new Event("bench"));
+    }
+    BenchmarksInternal::Report("wrap/constructor", count, BenchmarksInternal::NowMillis() - start);
+
+    start = BenchmarksInternal::NowMillis();
+    for (int i = 0; i < count; i++) {
+        HandleScope inner(isolate);
+        (new Event("bench"))->Wrap(isolate, context);
+    }
+    BenchmarksInternal::Report("wrap/boilerplate", count, BenchmarksInternal::NowMillis() - start);
+}
+
+void Benchmarks::InterfaceTemplateLookup(Isolate* isolate, int count) {
+
+    HandleScope hs(isolate);
+
+    const WrapperTypeInfo* types[kBenchmarkTypeCount];
+    BenchmarksInternal::BenchTypes<kBenchmarkTypeCount>::Collect(types);
+
+    // what Config::InterfaceTemplate used to look up on every Wrap.
+    std::map<std::string, Eternal<FunctionTemplate>> by_name;
+
+    for (int i = 0; i < kBenchmarkTypeCount; i++) {
+        snprintf(BenchmarksInternal::benchTypeNames[i], sizeof(BenchmarksInternal::benchTypeNames[i]),
+                 "BenchType%d", i);
+        Local<FunctionTemplate> ft = types[i]->template_function(isolate);
+        by_name.insert(
+                std::pair<std::string, Eternal<FunctionTemplate>>(
+                        types[i]->interface_name,
+                        Eternal<FunctionTemplate>(isolate, ft)));
+    }
+
+    double start = BenchmarksInternal::NowMillis();
+    for (int i = 0; i < count; i++) {
+        HandleScope inner(isolate);
+        std::string name = types[i % kBenchmarkTypeCount]->interface_name;
+        by_name.find(name)->second.Get(isolate);
+    }
+    BenchmarksInternal::Report("template/string-map", count, BenchmarksInternal::NowMillis() - start);
+
+    start = BenchmarksInternal::NowMillis();
+    for (int i = 0; i < count; i++) {
+        HandleScope inner(isolate);
+        types[i % kBenchmarkTypeCount]->template_function(isolate);
+    }
+    BenchmarksInternal::Report("template/index", count, BenchmarksInternal::NowMillis() - start);
+}
+
+void Benchmarks::WrapBatch(Isolate* isolate, Local<Context> context, int bursts, int burst_size) {
+
+    HandleScope hs(isolate);
+    Context::Scope context_scope(context);
+
+    std::vector<Wrappable*> events(burst_size);
+    Local<Array> wrappers = Array::New(isolate, burst_size);
+
+    double start = BenchmarksInternal::NowMillis();
+    for (int i = 0; i < bursts; i++) {
+        for (int j = 0; j < burst_size; j++) {
+            HandleScope inner(isolate);
+            Local<Object> wrapper = (new Event("bench"))->Wrap(isolate, context);
+            wrappers->Set(context, static_cast<uint32_t>(j), wrapper).FromJust();
+        }
+    }
+    BenchmarksInternal::Report("wrap/single", bursts * burst_size, BenchmarksInternal::NowMillis() - start);
+
+    start = BenchmarksInternal::NowMillis();
+    for (int i = 0; i < bursts; i++) {
+        HandleScope inner(isolate);
+        for (int j = 0; j < burst_size; j++) {
+            events[j] = new Event("bench");
+        }
+        Wrappable::WrapAll(isolate, context, events.data(), events.size());
+    }
+    BenchmarksInternal::Report("wrap/batch", bursts * burst_size, BenchmarksInternal::NowMillis() - start);
+}
+
+void Benchmarks::Dispatch(Isolate* isolate, Local<Context> context, int count) {
+
+    HandleScope hs(isolate);
+    Context::Scope context_scope(context);
+
+    // each call returns a new listener function.
+    Local<Function> listener_factory = Local<Function>::Cast(
+            Script::Compile(context, String::NewFromUtf8(isolate,
+                    "(function() { return function(e) { this.received = e.type; }; })"))
+                    .ToLocalChecked()->Run(context).ToLocalChecked());
+
+    const int listener_counts[] = {1, 10, 100};
+
+    for (int listener_count : listener_counts) {
+
+        EventTarget* target = new EventTarget();
+        target->Wrap(isolate, context);
+
+        for (int i = 0; i < listener_count; i++) {
+            Local<Value> listener =
+                    listener_factory->Call(context, Undefined(isolate), 0, nullptr).ToLocalChecked();
+            target->AddEventListener(isolate, "bench", listener.As<Function>());
+        }
+
+        double start = BenchmarksInternal::NowMillis();
+        for (int i = 0; i < count; i++) {
+            HandleScope inner(isolate);
+            target->DispatchEvent(isolate, context, new Event("bench"));
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "dispatch/%d-listeners", listener_count);
+        BenchmarksInternal::Report(name, count, BenchmarksInternal::NowMillis() - start);
+    }
+}
+
+void Benchmarks::IsolatePoolThroughput(int count) {
+
+    const std::string source =
+            "var ev = new Event('job'); var sum = 0; for (var i = 0; i < 20000; i++) { sum += i % 7; } sum;";
+
+    unsigned int cores = std::thread::hardware_concurrency();
+    if (cores == 0) {
+        cores = 1;
+    }
+
+    for (unsigned int workers = 1; workers <= cores; workers++) {
+        IsolatePool pool(workers);
+
+        // isolate creation and first compile are not part of the measure.
+        std::vector<std::future<IsolatePool::Result>> results;
+        for (unsigned int i = 0; i < workers; i++) {
+            results.push_back(pool.Run("bench", source));
+        }
+        for (auto& result : results) {
+            result.wait();
+        }
+        results.clear();
+
+        double start = BenchmarksInternal::NowMillis();
+        for (int i = 0; i < count; i++) {
+            results.push_back(pool.Run("bench", source));
+        }
+        for (auto& result : results) {
+            result.wait();
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "isolate-pool/%u-workers", workers);
+        BenchmarksInternal::Report(name, count, BenchmarksInternal::NowMillis() - start);
+    }
+}
+
+void Benchmarks::ContextAcquire(Isolate* isolate, int count) {
+
+    double start = BenchmarksInternal::NowMillis();
+    for (int i = 0; i < count; i++) {
+        HandleScope hs(isolate);
+        ContextPool::NewEnvironmentContext(isolate);
+        isolate->ContextDisposedNotification();
+    }
+    BenchmarksInternal::Report("context/new", count, BenchmarksInternal::NowMillis() - start);
+
+    ContextPool pool(isolate, 1);
+    double elapsed = 0;
+    for (int i = 0; i < count; i++) {
+        HandleScope hs(isolate);
+        // refill is off the request path: only the acquire is measured.
+        pool.Refill();
+        start = BenchmarksInternal::NowMillis();
+        Local<Context> context = pool.Acquire();
+        elapsed += BenchmarksInternal::NowMillis() - start;
+        pool.Release(context);
+    }
+    BenchmarksInternal::Report("context/pool", count, elapsed);
+
+    ContextPool::Statistics stats = pool.GetStatistics();
+    LOGV("bench context/pool: acquire p50 %.4fms p99 %.4fms", stats.p50_acquire_ms, stats.p99_acquire_ms);
+}
+
+void Benchmarks::ArrayBufferChurn(Isolate* isolate, Local<Context> context, int count) {
+
+    HandleScope hs(isolate);
+    Context::Scope context_scope(context);
+
+    char source[160];
+    snprintf(source, sizeof(source),
+             "(function() { var sum = 0; for (var i = 0; i < %d; i++) { sum += new Float64Array(8 << (i %% 6)).length; } return sum; })()",
+             count);
+
+    Local<Script> script = Script::Compile(context, String::NewFromUtf8(isolate, source)).ToLocalChecked();
+
+    double start = BenchmarksInternal::NowMillis();
+    script->Run(context).ToLocalChecked();
+    BenchmarksInternal::Report("arraybuffer/churn", count, BenchmarksInternal::NowMillis() - start);
+}
+
+void Benchmarks::LogSlabStatistics() {
+
+    std::vector<Config::SlabStatistics> statistics;
+    Config::SlabAllocator::GetStatistics(statistics);
+
+    for (const Config::SlabStatistics& slab : statistics) {
+        LOGV("slab %s: %zu bytes/object, %zu live, %zu slabs, %.1f%% occupancy",
+             slab.name, slab.object_size, slab.live_objects, slab.slab_count, slab.Occupancy() * 100);
+    }
+}
@@ -0,0 +1,78 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_BENCHMARKS_H
+#define HYPERCASINO_BENCHMARKS_H
+
+#include <v8.h>
+
+using namespace v8;
+
+/**
+ * Native micro benchmarks for the bindings layer.
+ * Results are written to the log. Only run when compiled with HC_BENCHMARKS.
+ */
+class Benchmarks {
+public:
+
+    // This class must be static only
+    Benchmarks() = delete;
+
+    Benchmarks(const Benchmarks &) = delete;
+
+    Benchmarks &operator=(const Benchmarks &) = delete;
+
+    static void Run(Isolate *isolate, Local<Context> context);
+
+    /**
+     * Wraps native Events by running the js constructor (old path) and by cloning the
+     * per type boilerplate (Wrappable::Wrap), and reports wraps/sec for both.
+     */
+    static void Wrap(Isolate *isolate, Local<Context> context, int count);
+
+    /**
+     * Registers kBenchmarkTypeCount synthetic wrapper types and compares interface template
+     * lookups through a std::string keyed map against the per isolate index.
+     */
+    static void InterfaceTemplateLookup(Isolate *isolate, int count);
+
+    static const int kBenchmarkTypeCount = 256;
+
+    /**
+     * Wraps bursts of burst_size native Events one by one, each in its own handle scope, and
+     * with Wrappable::WrapAll.
+     */
+    static void WrapBatch(Isolate *isolate, Local<Context> context, int bursts, int burst_size);
+
+    /**
+     * Dispatches count Events to an EventTarget with 1, 10 and 100 listeners, and reports
+     * events/sec.
+     */
+    static void Dispatch(Isolate *isolate, Local<Context> context, int count);
+
+    /**
+     * Runs count CPU bound scripts on an IsolatePool of 1 to hardware_concurrency workers, and
+     * reports scripts/sec for each worker count.
+     */
+    static void IsolatePoolThroughput(int count);
+
+    /**
+     * Acquires count contexts with Context::New and from a ContextPool refilled between
+     * acquires, and reports acquires/sec and the pool's p50/p99 latency.
+     */
+    static void ContextAcquire(Isolate *isolate, int count);
+
+    /**
+     * Creates count short lived Float64Arrays of a few sizes from script, and reports
+     * arrays/sec with the isolate's ArrayBuffer::Allocator.
+     */
+    static void ArrayBufferChurn(Isolate *isolate, Local<Context> context, int count);
+
+    /**
+     * Logs live objects and slab occupancy for every slab allocated type.
+     */
+    static void LogSlabStatistics();
+};
+
+#endif //HYPERCASINO_BENCHMARKS_H
@@ -0,0 +1,256 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_BINDINGS_H
+#define HYPERCASINO_BINDINGS_H
+
+#include <string>
+#include <v8.h>
+#include "Configuration.h"
+#include "PerIsolateData.h"
+#include "Wrappable.h"
+
+/**
+ * Compile time generation of accessor and method callbacks from C++ member pointers.
+ *
+ * Each generated callback is a trampoline specialized for the member it binds: it resolves the
+ * holder with ToImpl, calls the member and converts the result with a type specific ToV8
+ * overload. There is no boxing to a generic value type in between.
+ *
+ *   {"timeStamp", HC_GETTER(Event, TimeStamp), nullptr, v8::DontDelete, Config::kOnPrototype}
+ *
+ * Use these macros for AccessorConfiguration and MethodConfiguration entries.
+ */
+#define HC_GETTER(Class, member) \
+        Config::Trampoline<decltype(&Class::member), &Class::member>::Getter
+
+#define HC_SETTER(Class, member) \
+        Config::Trampoline<decltype(&Class::member), &Class::member>::Setter
+
+#define HC_METHOD(Class, member) \
+        Config::Trampoline<decltype(&Class::member), &Class::member>::Method
+
+namespace Config {
+
+    typedef v8::FunctionCallbackInfo<v8::Value> CallbackInfo;
+
+    // return conversions.
+
+    inline void ToV8(const CallbackInfo &info, bool value) {
+        info.GetReturnValue().Set(value);
+    }
+
+    inline void ToV8(const CallbackInfo &info, int32_t value) {
+        info.GetReturnValue().Set(value);
+    }
+
+    inline void ToV8(const CallbackInfo &info, uint32_t value) {
+        info.GetReturnValue().Set(value);
+    }
+
+    inline void ToV8(const CallbackInfo &info, long value) {
+        info.GetReturnValue().Set(static_cast<double>(value));
+    }
+
+    inline void ToV8(const CallbackInfo &info, long long value) {
+        info.GetReturnValue().Set(static_cast<double>(value));
+    }
+
+    inline void ToV8(const CallbackInfo &info, double value) {
+        info.GetReturnValue().Set(value);
+    }
+
+    inline void ToV8(const CallbackInfo &info, float value) {
+        info.GetReturnValue().Set(static_cast<double>(value));
+    }
+
+    // native strings are names. Return the isolate's internalized atom.
+    inline void ToV8(const CallbackInfo &info, const char *value) {
+        if (value == nullptr) {
+            info.GetReturnValue().SetNull();
+        } else {
+            info.GetReturnValue().Set(PerIsolateData::From(info.GetIsolate())->Atoms().Get(value));
+        }
+    }
+
+    inline void ToV8(const CallbackInfo &info, const std::string &value) {
+        info.GetReturnValue().Set(
+                v8::String::NewFromUtf8(info.GetIsolate(), value.c_str(), v8::NewStringType::kNormal,
+                                        static_cast<int>(value.length())).ToLocalChecked());
+    }
+
+    // wrappables are returned as their wrapper. Wrapped on demand in the current context.
+    inline void ToV8(const CallbackInfo &info, Wrappable *value) {
+        if (value == nullptr) {
+            info.GetReturnValue().SetNull();
+        } else {
+            v8::Isolate* isolate = info.GetIsolate();
+            info.GetReturnValue().Set(value->Wrap(isolate, isolate->GetCurrentContext()));
+        }
+    }
+
+    // argument conversions.
+
+    template<typename T>
+    struct FromV8;
+
+    template<>
+    struct FromV8<bool> {
+        static bool Convert(v8::Isolate *isolate, v8::Local<v8::Value> value) {
+            return value->BooleanValue(isolate->GetCurrentContext()).FromMaybe(false);
+        }
+    };
+
+    template<>
+    struct FromV8<int32_t> {
+        static int32_t Convert(v8::Isolate *isolate, v8::Local<v8::Value> value) {
+            return value->Int32Value(isolate->GetCurrentContext()).FromMaybe(0);
+        }
+    };
+
+    template<>
+    struct FromV8<uint32_t> {
+        static uint32_t Convert(v8::Isolate *isolate, v8::Local<v8::Value> value) {
+            return value->Uint32Value(isolate->GetCurrentContext()).FromMaybe(0);
+        }
+    };
+
+    template<>
+    struct FromV8<long> {
+        static long Convert(v8::Isolate *isolate, v8::Local<v8::Value> value) {
+            return static_cast<long>(value->NumberValue(isolate->GetCurrentContext()).FromMaybe(0));
+        }
+    };
+
+    template<>
+    struct FromV8<double> {
+        static double Convert(v8::Isolate *isolate, v8::Local<v8::Value> value) {
+            return value->NumberValue(isolate->GetCurrentContext()).FromMaybe(0);
+        }
+    };
+
+    template<>
+    struct FromV8<std::string> {
+        static std::string Convert(v8::Isolate *isolate, v8::Local<v8::Value> value) {
+            v8::String::Utf8Value utf(value);
+            return *utf != nullptr ? std::string(*utf, utf.length()) : std::string();
+        }
+    };
+
+    // wrappable arguments. Anything not being a T wrapper, or a subclass', converts to nullptr.
+    template<typename T>
+    struct FromV8<T *> {
+        static T *Convert(v8::Isolate *isolate, v8::Local<v8::Value> value) {
+            if (!T::GetStaticWrapperTypeInfo()->template_function(isolate)->HasInstance(value)) {
+                return nullptr;
+            }
+            return static_cast<T *>(ToImpl<Wrappable>(value.As<v8::Object>()));
+        }
+    };
+
+    template<typename T>
+    struct FromV8<const T &> : FromV8<T> {};
+
+    template<typename T>
+    struct FromV8<const T> : FromV8<T> {};
+
+    // index sequence for argument unpacking.
+
+    template<size_t...>
+    struct IndexSequence {};
+
+    template<size_t N, size_t... Is>
+    struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Is...> {};
+
+    template<size_t... Is>
+    struct MakeIndexSequence<0, Is...> {
+        typedef IndexSequence<Is...> Type;
+    };
+
+    template<typename C>
+    C *HolderImpl(const CallbackInfo &info) {
+        return static_cast<C *>(ToImpl<Wrappable>(info.Holder()));
+    }
+
+    template<typename R, typename... Args>
+    struct Invoker {
+        template<typename C, typename M, size_t... Is>
+        static void Call(const CallbackInfo &info, C *impl, M method, IndexSequence<Is...>) {
+            ToV8(info, (impl->*method)(
+                    FromV8<Args>::Convert(info.GetIsolate(), info[Is])...));
+        }
+    };
+
+    template<typename... Args>
+    struct Invoker<void, Args...> {
+        template<typename C, typename M, size_t... Is>
+        static void Call(const CallbackInfo &info, C *impl, M method, IndexSequence<Is...>) {
+            (impl->*method)(FromV8<Args>::Convert(info.GetIsolate(), info[Is])...);
+        }
+    };
+
+    template<typename M, M member>
+    struct Trampoline;
+
+    // data members.
+    template<typename C, typename T, T C::*member>
+    struct Trampoline<T C::*, member> {
+
+        static void Getter(const CallbackInfo &info) {
+            C *impl = HolderImpl<C>(info);
+            if (impl == nullptr) {
+                info.GetReturnValue().SetNull();
+                return;
+            }
+            ToV8(info, impl->*member);
+        }
+
+        static void Setter(const CallbackInfo &info) {
+            C *impl = HolderImpl<C>(info);
+            if (impl != nullptr) {
+                impl->*member = FromV8<T>::Convert(info.GetIsolate(), info[0]);
+            }
+        }
+    };
+
+    // const member functions, used as getters or methods.
+    template<typename C, typename R, typename... Args, R (C::*member)(Args...) const>
+    struct Trampoline<R (C::*)(Args...) const, member> {
+
+        static void Getter(const CallbackInfo &info) {
+            Method(info);
+        }
+
+        static void Method(const CallbackInfo &info) {
+            C *impl = HolderImpl<C>(info);
+            if (impl == nullptr) {
+                info.GetReturnValue().SetNull();
+                return;
+            }
+            Invoker<R, Args...>::Call(info, impl, member,
+                                      typename MakeIndexSequence<sizeof...(Args)>::Type());
+        }
+    };
+
+    // member functions, used as setters or methods.
+    template<typename C, typename R, typename... Args, R (C::*member)(Args...)>
+    struct Trampoline<R (C::*)(Args...), member> {
+
+        static void Setter(const CallbackInfo &info) {
+            Method(info);
+        }
+
+        static void Method(const CallbackInfo &info) {
+            C *impl = HolderImpl<C>(info);
+            if (impl == nullptr) {
+                Throw(info.GetIsolate(), "Illegal invocation");
+                return;
+            }
+            Invoker<R, Args...>::Call(info, impl, member,
+                                      typename MakeIndexSequence<sizeof...(Args)>::Type());
+        }
+    };
+}
+
+#endif //HYPERCASINO_BINDINGS_H
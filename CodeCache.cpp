@@ -0,0 +1,197 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+#include "CodeCache.h"
+
+namespace CodeCacheInternal {
+
+    double NowMillis() {
+        return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+CodeCache::CodeCache(const char* directory) :
+        directory_(directory),
+        hits_(0),
+        misses_(0),
+        rejected_(0),
+        hit_compile_us_(0),
+        miss_compile_us_(0) {
+}
+
+uint64_t CodeCache::Hash(const char* data, size_t length) {
+    // FNV-1a, 64 bits.
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string CodeCache::CachePath(uint64_t source_hash) const {
+    char name[64];
+    snprintf(name, sizeof(name), "/%016llx-%08x.ccache",
+             static_cast<unsigned long long>(source_hash),
+             ScriptCompiler::CachedDataVersionTag());
+    return directory_ + name;
+}
+
+ScriptCompiler::CachedData* CodeCache::Load(const std::string& path) const {
+
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+
+    ScriptCompiler::CachedData* data = nullptr;
+
+    if (fseek(file, 0, SEEK_END) == 0) {
+        long length = ftell(file);
+        if (length > 0 && fseek(file, 0, SEEK_SET) == 0) {
+            uint8_t* buffer = new uint8_t[length];
+            if (fread(buffer, 1, length, file) == static_cast<size_t>(length)) {
+                data = new ScriptCompiler::CachedData(
+                        buffer, static_cast<int>(length), ScriptCompiler::CachedData::BufferOwned);
+            } else {
+                delete[] buffer;
+            }
+        }
+    }
+
+    fclose(file);
+    return data;
+}
+
+void CodeCache::Store(const std::string& path, const ScriptCompiler::CachedData* data) const {
+
+    if (data == nullptr || data->length <= 0) {
+        return;
+    }
+
+    // isolates on other threads may store the same source.
+    WriteFile(path, nullptr, 0, data->data, static_cast<size_t>(data->length));
+}
+
+bool CodeCache::WriteFile(const std::string& path,
+                          const void* header, size_t header_length,
+                          const void* data, size_t length) {
+
+    // each writer gets its own temporary file.
+    std::string temp = path + ".XXXXXX";
+    int fd = mkstemp(&temp[0]);
+    if (fd == -1) {
+        return false;
+    }
+
+    FILE* file = fdopen(fd, "wb");
+    if (file == nullptr) {
+        close(fd);
+        unlink(temp.c_str());
+        return false;
+    }
+
+    bool written = (header_length == 0 || fwrite(header, 1, header_length, file) == header_length) &&
+                   fwrite(data, 1, length, file) == length;
+    written = fclose(file) == 0 && written;
+
+    if (!written || rename(temp.c_str(), path.c_str()) != 0) {
+        unlink(temp.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+ScriptCompiler::CompileOptions CodeCache::Options(const std::string& path, ScriptCompiler::CachedData** data) {
+    *data = Load(path);
+    return *data != nullptr ? ScriptCompiler::kConsumeCodeCache : ScriptCompiler::kProduceCodeCache;
+}
+
+void CodeCache::Account(const std::string& path,
+                        ScriptCompiler::CompileOptions options,
+                        const ScriptCompiler::Source& source,
+                        double compile_ms) {
+
+    uint64_t compile_us = static_cast<uint64_t>(compile_ms * 1000);
+
+    if (options == ScriptCompiler::kConsumeCodeCache) {
+        if (!source.GetCachedData()->rejected) {
+            hits_++;
+            hit_compile_us_ += compile_us;
+            return;
+        }
+
+        // produced on the next compilation.
+        rejected_++;
+        miss_compile_us_ += compile_us;
+        remove(path.c_str());
+        return;
+    }
+
+    misses_++;
+    miss_compile_us_ += compile_us;
+    Store(path, source.GetCachedData());
+}
+
+MaybeLocal<Script> CodeCache::Compile(Local<Context> context,
+                                      Local<String> source_string,
+                                      const ScriptOrigin& origin,
+                                      uint64_t source_hash) {
+
+    std::string path = CachePath(source_hash);
+
+    ScriptCompiler::CachedData* data;
+    ScriptCompiler::CompileOptions options = Options(path, &data);
+
+    // source owns the cached data.
+    ScriptCompiler::Source source(source_string, origin, data);
+
+    double start = CodeCacheInternal::NowMillis();
+    MaybeLocal<Script> script = ScriptCompiler::Compile(context, &source, options);
+    double compile_ms = CodeCacheInternal::NowMillis() - start;
+
+    if (!script.IsEmpty()) {
+        Account(path, options, source, compile_ms);
+    }
+
+    return script;
+}
+
+MaybeLocal<UnboundScript> CodeCache::CompileUnbound(Isolate* isolate,
+                                                    Local<String> source_string,
+                                                    const ScriptOrigin& origin,
+                                                    uint64_t source_hash) {
+
+    std::string path = CachePath(source_hash);
+
+    ScriptCompiler::CachedData* data;
+    ScriptCompiler::CompileOptions options = Options(path, &data);
+
+    ScriptCompiler::Source source(source_string, origin, data);
+
+    double start = CodeCacheInternal::NowMillis();
+    MaybeLocal<UnboundScript> script = ScriptCompiler::CompileUnboundScript(isolate, &source, options);
+    double compile_ms = CodeCacheInternal::NowMillis() - start;
+
+    if (!script.IsEmpty()) {
+        Account(path, options, source, compile_ms);
+    }
+
+    return script;
+}
+
+CodeCache::Statistics CodeCache::GetStatistics() const {
+    return {
+            hits_.load(),
+            misses_.load(),
+            rejected_.load(),
+            hit_compile_us_.load() / 1000.0,
+            miss_compile_us_.load() / 1000.0
+    };
+}
@@ -0,0 +1,94 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_CODECACHE_H
+#define HYPERCASINO_CODECACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <v8.h>
+
+using namespace v8;
+
+/**
+ * Persistent code cache for scripts.
+ * Compiled code is stored on disk as ScriptCompiler::CachedData, one file per source, keyed by
+ * source hash and ScriptCompiler::CachedDataVersionTag(). Later compilations of the same source
+ * consume it. Data rejected by v8 (different flags, corrupt file) is deleted and produced again
+ * on the next compilation.
+ *
+ * Can be shared by isolates on different threads.
+ */
+class CodeCache {
+public:
+
+    struct Statistics {
+        uint64_t hits;                  // compiled from cached data.
+        uint64_t misses;                // compiled from source, and cached data produced.
+        uint64_t rejected;              // cached data found, but rejected by v8.
+        double hit_compile_ms;          // total compile time for hits.
+        double miss_compile_ms;         // total compile time for misses and rejections.
+    };
+
+    explicit CodeCache(const char* directory);
+
+    CodeCache(const CodeCache&) = delete;
+    CodeCache& operator=(const CodeCache&) = delete;
+
+    /**
+     * Compile source bound to context, consuming or producing cached data.
+     * @param source_hash hash of the source contents. See Hash.
+     */
+    MaybeLocal<Script> Compile(Local<Context> context,
+                               Local<String> source,
+                               const ScriptOrigin& origin,
+                               uint64_t source_hash);
+
+    /**
+     * Same as Compile, for context independent scripts.
+     */
+    MaybeLocal<UnboundScript> CompileUnbound(Isolate* isolate,
+                                             Local<String> source,
+                                             const ScriptOrigin& origin,
+                                             uint64_t source_hash);
+
+    Statistics GetStatistics() const;
+
+    static uint64_t Hash(const char* data, size_t length);
+
+    /**
+     * Write header, if any, then data to path through a private temporary file and a rename,
+     * so that readers never see a partial file, even with other threads or processes writing
+     * the same path. The temporary file is removed on failure.
+     */
+    static bool WriteFile(const std::string& path,
+                          const void* header, size_t header_length,
+                          const void* data, size_t length);
+
+private:
+
+    std::string CachePath(uint64_t source_hash) const;
+
+    ScriptCompiler::CachedData* Load(const std::string& path) const;
+    void Store(const std::string& path, const ScriptCompiler::CachedData* data) const;
+
+    /**
+     * Load cached data from path, and choose the compile options accordingly. Account records
+     * the outcome of the compilation that follows.
+     */
+    ScriptCompiler::CompileOptions Options(const std::string& path, ScriptCompiler::CachedData** data);
+    void Account(const std::string& path, ScriptCompiler::CompileOptions options,
+                 const ScriptCompiler::Source& source, double compile_ms);
+
+    std::string directory_;
+
+    std::atomic<uint64_t> hits_;
+    std::atomic<uint64_t> misses_;
+    std::atomic<uint64_t> rejected_;
+    std::atomic<uint64_t> hit_compile_us_;
+    std::atomic<uint64_t> miss_compile_us_;
+};
+
+#endif //HYPERCASINO_CODECACHE_H
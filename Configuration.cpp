@@ -2,14 +2,11 @@
 // Created by hyperandroid on 20/11/2015.
 //
 
-#include <map>
-#include <string>
 #include "Configuration.h"
+#include "PerIsolateData.h"
 
 using namespace v8;
 
-Config::ConstructorMode Config::Status::CurrentConstructorMode = Config::ConstructorMode::kCreateNewObject;
-
 void Config::InstallAccessors(
         Isolate *isolate,
         v8::Local<ObjectTemplate> instance_or_template,
@@ -126,28 +123,53 @@ void Config::InstallMethod(
     }
 }
 
-static std::map<std::string, Eternal<FunctionTemplate>> iterfaceTemplates_;
-
 Local<FunctionTemplate> Config::InterfaceTemplate( v8::Isolate* isolate,
                                            const WrapperTypeInfo& typeInfo,
                                            Config::InstallTemplateFunction itf) {
 
-    std::string name = typeInfo.interface_name;
-    auto iter= iterfaceTemplates_.find(name);
-    if ( iter != iterfaceTemplates_.end() ) {
-        return (*iter).second.Get(isolate);
+    PerIsolateData* data = PerIsolateData::From(isolate);
+    Local<FunctionTemplate> cached = data->FindInterfaceTemplate(typeInfo);
+    if ( !cached.IsEmpty() ) {
+        return cached;
     }
 
     auto ft = v8::FunctionTemplate::New( isolate );
     itf(isolate, ft );
-    iterfaceTemplates_.insert(
-            std::pair<std::string, v8::Eternal<v8::FunctionTemplate>>(
-                    name,
-                    v8::Eternal<v8::FunctionTemplate>(isolate, ft)));
+    data->SetInterfaceTemplate(typeInfo, ft);
 
     return ft;
 }
 
+Local<Object> Config::NewWrapperInstance(v8::Isolate* isolate,
+                                         v8::Local<v8::Context> creation_context,
+                                         const WrapperTypeInfo& typeInfo) {
+
+    return WrapperBoilerplate(isolate, creation_context, typeInfo)->Clone();
+}
+
+Local<Object> Config::WrapperBoilerplate(v8::Isolate* isolate,
+                                         v8::Local<v8::Context> creation_context,
+                                         const WrapperTypeInfo& typeInfo) {
+
+    PerIsolateData* data = PerIsolateData::From(isolate);
+    Local<Object> boilerplate = data->FindWrapperBoilerplate(typeInfo);
+    if ( !boilerplate.IsEmpty() && boilerplate->CreationContext() == creation_context ) {
+        return boilerplate;
+    }
+
+    {
+        // slow path. run the constructor in wrap mode so that no native object is created.
+        ConstructorModeScope wrap_mode(isolate, kWrapExistingObject);
+
+        boilerplate = typeInfo.template_function(isolate)->
+                GetFunction(creation_context).ToLocalChecked()->
+                NewInstance(creation_context).ToLocalChecked();
+    }
+
+    data->SetWrapperBoilerplate(typeInfo, boilerplate);
+
+    return boilerplate;
+}
 
 void Config::SetClassString(
         v8::Isolate* isolate,
@@ -184,6 +206,30 @@ void Config::InitializeInterfaceTemplate(v8::Isolate* isolate,
     }
 }
 
+void Config::AppendExternalReferences(ExternalReferenceTable& table,
+                                      const char* interface_name,
+                                      const AccessorConfiguration* props,
+                                      size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        std::string name(props[i].name);
+        if ( props[i].getter != nullptr ) {
+            table.Append(interface_name, (name + ":get").c_str(), props[i].getter);
+        }
+        if ( props[i].setter != nullptr ) {
+            table.Append(interface_name, (name + ":set").c_str(), props[i].setter);
+        }
+    }
+}
+
+void Config::AppendExternalReferences(ExternalReferenceTable& table,
+                                      const char* interface_name,
+                                      const MethodConfiguration* methods,
+                                      size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        table.Append(interface_name, methods[i].name, methods[i].callback);
+    }
+}
+
 void Config::Throw(v8::Isolate* isolate_, const char* message) {
     if (!isolate_->IsExecutionTerminating()) {
         isolate_->ThrowException(
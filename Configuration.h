@@ -5,12 +5,36 @@
 #ifndef HYPERCASINO_CONFIGURATION_H
 #define HYPERCASINO_CONFIGURATION_H
 
+#include <string>
+#include <vector>
 #include <v8.h>
 
+class Wrappable;
+
 namespace Config {
 
     typedef v8::Local<v8::FunctionTemplate> (*CreateTemplateFunction)(v8::Isolate*);
 
+    // rebuild a native object from the state written by Wrappable::SerializeInternalFields.
+    typedef Wrappable* (*DeserializeWrappableFunction)(const char* data, size_t length);
+
+    /**
+     * Dense, compile time index for every wrapper type.
+     * Per isolate caches are flat arrays indexed by it. Add new wrapper types before
+     * kWrapperTypeCount.
+     */
+    enum WrapperTypeIndex : uint16_t {
+        kEventIndex,
+        kEventTargetIndex,
+        kWrapperTypeCount
+    };
+
+    // wrapper class id for wrappables whose lifetime is managed by the GC.
+    const uint16_t HC_GARBAGE_COLLECTED_CLASS_ID = 16;
+
+    // context embedder data slot for the context's ModuleLoader. 0 is reserved by the debugger.
+    const int HC_MODULE_LOADER_EMBEDDER_INDEX = 1;
+
     class WrapperTypeInfo {
     public:
 
@@ -19,6 +43,8 @@ namespace Config {
         CreateTemplateFunction parent_class;
         int internal_field_count;
         uint16_t gc_class_id;
+        uint16_t index;                                 // WrapperTypeIndex
+        DeserializeWrappableFunction deserialize;       // nullptr if not snapshotable.
     };
 
     enum ConstructorMode : unsigned { kWrapExistingObject, kCreateNewObject };
@@ -29,10 +55,6 @@ namespace Config {
         kOnInterface = 1 << 2,
     };
 
-    struct Status {
-        static ConstructorMode CurrentConstructorMode;
-    };
-
     template<typename T, size_t Size>
     char (&ArrayLengthHelperFunction(T (&)[Size]))[Size];
 
@@ -66,6 +88,8 @@ namespace Config {
         int length;
     };
 
+    // field 0 holds a Wrappable*. Read it as Wrappable, and static_cast to a subclass: a plain
+    // reinterpret_cast breaks for classes where Wrappable is not the first base, like Event.
     template<class T>
     T *ToImpl(v8::Local<v8::Object> object) {
         return reinterpret_cast<T *>(object->GetAlignedPointerFromInternalField(0));
@@ -118,6 +142,24 @@ namespace Config {
                                                       const WrapperTypeInfo &,
                                                       InstallTemplateFunction);
 
+    /**
+     * Create a new, not yet associated, wrapper object for the given type.
+     * The constructor function runs only once per isolate and type to build a boilerplate
+     * object, and every other wrapper is a shallow Clone of it.
+     * The boilerplate is rebuilt if the creation context changes.
+     */
+    v8::Local<v8::Object> NewWrapperInstance(v8::Isolate *,
+                                             v8::Local<v8::Context> creation_context,
+                                             const WrapperTypeInfo &);
+
+    /**
+     * The boilerplate NewWrapperInstance clones from. Callers wrapping many objects of the same
+     * type can fetch it once and Clone it themselves.
+     */
+    v8::Local<v8::Object> WrapperBoilerplate(v8::Isolate *,
+                                             v8::Local<v8::Context> creation_context,
+                                             const WrapperTypeInfo &);
+
     typedef void (*InstallTemplateFunction)(v8::Isolate*,
                                             v8::Local<v8::FunctionTemplate>);
 
@@ -125,6 +167,35 @@ namespace Config {
                                      v8::Local<v8::FunctionTemplate>,
                                      const WrapperTypeInfo &);
 
+    /**
+     * Snapshot external references table, and its layout: the name of every reference, in table
+     * order. Blobs keep a hash of the layout, since a table of the same size from another build
+     * may hold different callbacks.
+     */
+    struct ExternalReferenceTable {
+        std::vector<intptr_t> references;
+        std::string layout;
+
+        void Append(const char *interface_name, const char *name, v8::FunctionCallback callback) {
+            references.push_back(reinterpret_cast<intptr_t>(callback));
+            layout.append(interface_name).append(".").append(name).append(";");
+        }
+    };
+
+    /**
+     * Append every callback in the configuration tables to a snapshot external references
+     * table.
+     */
+    void AppendExternalReferences(ExternalReferenceTable &table,
+                                  const char *interface_name,
+                                  const AccessorConfiguration *props,
+                                  size_t length);
+
+    void AppendExternalReferences(ExternalReferenceTable &table,
+                                  const char *interface_name,
+                                  const MethodConfiguration *methods,
+                                  size_t length);
+
     void Throw(v8::Isolate* isolate_, const char* message);
 }
 
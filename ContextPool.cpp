@@ -0,0 +1,123 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <algorithm>
+#include <chrono>
+#include "ContextPool.h"
+#include "Environment.h"
+
+namespace ContextPoolInternal {
+
+    double NowMillis() {
+        return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    double Percentile(std::vector<double> samples, double percentile) {
+        if (samples.empty()) {
+            return 0;
+        }
+        size_t n = static_cast<size_t>(percentile * (samples.size() - 1) + 0.5);
+        std::nth_element(samples.begin(), samples.begin() + n, samples.end());
+        return samples[n];
+    }
+}
+
+ContextPool::ContextPool(Isolate* isolate, size_t capacity, ContextFactory factory) :
+        isolate_(isolate),
+        capacity_(capacity),
+        factory_(factory != nullptr ? factory : NewEnvironmentContext),
+        next_latency_(0),
+        acquired_(0),
+        created_(0),
+        misses_(0),
+        disposed_(0),
+        recycled_(0) {
+    Refill();
+}
+
+ContextPool::~ContextPool() {
+    for (auto& context : idle_) {
+        context.Reset();
+    }
+    if (!idle_.empty()) {
+        isolate_->ContextDisposedNotification();
+    }
+}
+
+Local<Context> ContextPool::NewEnvironmentContext(Isolate* isolate) {
+    return Context::New(isolate, nullptr, Environment::GlobalTemplate(isolate));
+}
+
+Local<Context> ContextPool::Create() {
+    created_++;
+    return factory_(isolate_);
+}
+
+size_t ContextPool::Refill() {
+
+    size_t created = 0;
+    while (idle_.size() < capacity_) {
+        HandleScope hs(isolate_);
+        idle_.emplace_back(isolate_, Create());
+        created++;
+    }
+    return created;
+}
+
+Local<Context> ContextPool::Acquire() {
+
+    double start = ContextPoolInternal::NowMillis();
+
+    EscapableHandleScope hs(isolate_);
+    Local<Context> context;
+
+    if (!idle_.empty()) {
+        context = idle_.back().Get(isolate_);
+        idle_.back().Reset();
+        idle_.pop_back();
+    } else {
+        misses_++;
+        context = Create();
+    }
+
+    acquired_++;
+
+    double elapsed = ContextPoolInternal::NowMillis() - start;
+    if (latencies_.size() < kLatencySamples) {
+        latencies_.push_back(elapsed);
+    } else {
+        latencies_[next_latency_] = elapsed;
+    }
+    next_latency_ = (next_latency_ + 1) % kLatencySamples;
+
+    return hs.Escape(context);
+}
+
+void ContextPool::Release(Local<Context> context, ReleaseMode mode) {
+
+    if (mode == kRecycle && idle_.size() < capacity_) {
+        recycled_++;
+        idle_.emplace_back(isolate_, context);
+        return;
+    }
+
+    // the caller's handles are the last references. Let the GC know a context is gone, so it
+    // collects sooner.
+    disposed_++;
+    isolate_->ContextDisposedNotification();
+}
+
+ContextPool::Statistics ContextPool::GetStatistics() const {
+    return {
+            acquired_,
+            created_,
+            misses_,
+            disposed_,
+            recycled_,
+            idle_.size(),
+            ContextPoolInternal::Percentile(latencies_, 0.50),
+            ContextPoolInternal::Percentile(latencies_, 0.99)
+    };
+}
@@ -0,0 +1,95 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_CONTEXTPOOL_H
+#define HYPERCASINO_CONTEXTPOOL_H
+
+#include <cstdint>
+#include <vector>
+#include <v8.h>
+
+using namespace v8;
+
+/**
+ * Pre-created contexts for short lived script sessions.
+ * Sessions get fresh globals without paying Context::New on the request path: Acquire hands out
+ * an idle context, and Refill creates replacements later, off the request path, like in the
+ * host tick.
+ *
+ * Released contexts are disposed, and v8 told with ContextDisposedNotification. Sessions that
+ * are known not to modify their globals can recycle them instead.
+ *
+ * Isolate thread only.
+ */
+class ContextPool {
+public:
+
+    typedef Local<Context> (*ContextFactory)(Isolate* isolate);
+
+    enum ReleaseMode {
+        kDispose,
+        kRecycle
+    };
+
+    struct Statistics {
+        uint64_t acquired;
+        uint64_t created;
+        uint64_t misses;                // acquires that found no idle context and created one.
+        uint64_t disposed;
+        uint64_t recycled;
+        size_t idle;
+        double p50_acquire_ms;
+        double p99_acquire_ms;
+    };
+
+    static const size_t kLatencySamples = 1024;
+
+    /**
+     * @param capacity idle contexts to keep ready.
+     * @param factory creates the contexts. Defaults to the Environment global template.
+     */
+    ContextPool(Isolate* isolate, size_t capacity, ContextFactory factory = nullptr);
+    ~ContextPool();
+
+    ContextPool(const ContextPool&) = delete;
+    ContextPool& operator=(const ContextPool&) = delete;
+
+    Local<Context> Acquire();
+
+    void Release(Local<Context> context, ReleaseMode mode = kDispose);
+
+    /**
+     * Create contexts until capacity are idle.
+     * @return contexts created.
+     */
+    size_t Refill();
+
+    /**
+     * Percentiles are over the last kLatencySamples acquires.
+     */
+    Statistics GetStatistics() const;
+
+    static Local<Context> NewEnvironmentContext(Isolate* isolate);
+
+private:
+
+    Local<Context> Create();
+
+    Isolate* isolate_;
+    size_t capacity_;
+    ContextFactory factory_;
+
+    std::vector<Global<Context>> idle_;
+
+    std::vector<double> latencies_;     // ring of kLatencySamples.
+    size_t next_latency_;
+
+    uint64_t acquired_;
+    uint64_t created_;
+    uint64_t misses_;
+    uint64_t disposed_;
+    uint64_t recycled_;
+};
+
+#endif //HYPERCASINO_CONTEXTPOOL_H
@@ -0,0 +1,217 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <time.h>
+#include <vector>
+#include <main.h>
+#include "Environment.h"
+#include "Event.h"
+#include "V8Event.h"
+#include "V8EventTarget.h"
+#include "PerIsolateData.h"
+#include "CodeCache.h"
+
+namespace EnvironmentInternal {
+
+    // every binding, in WrapperTypeIndex order.
+    const Config::WrapperTypeInfo* const wrapperTypes[] = {
+            &V8Event::wrapperTypeInfo,
+            &V8EventTarget::wrapperTypeInfo,
+    };
+
+    static_assert(ARRAY_LENGTH(wrapperTypes) == Config::kWrapperTypeCount,
+                  "every WrapperTypeIndex needs its WrapperTypeInfo");
+
+    void Set(Local<Context> context, Local<Object> object, Config::AtomTable& atoms,
+             const char* name, Local<Value> value) {
+        object->Set(context, atoms.Get(name), value).FromJust();
+    }
+
+    void Set(Local<Context> context, Local<Object> object, Config::AtomTable& atoms,
+             const char* name, double value) {
+        Set(context, object, atoms, name, Number::New(context->GetIsolate(), value));
+    }
+
+    Local<Object> PauseStatistics(Local<Context> context, Config::AtomTable& atoms,
+                                  const Config::GcMetrics::PauseStatistics& pauses) {
+
+        Isolate* isolate = context->GetIsolate();
+        Local<Object> object = Object::New(isolate);
+
+        Set(context, object, atoms, "count", static_cast<double>(pauses.count));
+        Set(context, object, atoms, "totalMs", pauses.total_ms);
+        Set(context, object, atoms, "maxMs", pauses.max_ms);
+        Set(context, object, atoms, "lastMs", pauses.last_ms);
+        Set(context, object, atoms, "lastEndMs", pauses.last_end_ms);
+
+        Local<Array> histogram = Array::New(isolate, Config::GcMetrics::kBucketCount);
+        for (size_t i = 0; i < Config::GcMetrics::kBucketCount; i++) {
+            histogram->Set(context, static_cast<uint32_t>(i),
+                           Number::New(isolate, static_cast<double>(pauses.histogram[i]))).FromJust();
+        }
+        Set(context, object, atoms, "histogram", histogram);
+
+        return object;
+    }
+}
+
+const Config::WrapperTypeInfo* Environment::WrapperTypeInfoAt(size_t index) {
+    return index < Config::kWrapperTypeCount ? EnvironmentInternal::wrapperTypes[index] : nullptr;
+}
+
+void Environment::Log(const FunctionCallbackInfo<Value>& info) {
+
+    // naive implementation
+    v8::String::Utf8Value utf(info[0].As<v8::String>());
+    LOGV("%s", *utf );
+}
+
+void Environment::NativeFactory(const FunctionCallbackInfo<Value>& info) {
+
+    Isolate* isolate = info.GetIsolate();
+    HandleScope hs( isolate );
+
+    Event *ev = new Event("factory");
+
+    struct timespec __now;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &__now);
+    ev->timeStamp = __now.tv_sec;
+
+    Local<Object> new_js_event = ev->Wrap( isolate, isolate->GetCurrentContext() );
+    info.GetReturnValue().Set( new_js_event );
+}
+
+void Environment::Stats(const FunctionCallbackInfo<Value>& info) {
+
+    Isolate* isolate = info.GetIsolate();
+    HandleScope hs( isolate );
+    Local<Context> context = isolate->GetCurrentContext();
+
+    Config::PerIsolateData* data = Config::PerIsolateData::From(isolate);
+    Config::AtomTable& atoms = data->Atoms();
+    Config::GcMetrics& metrics = data->Metrics();
+
+    if ( metrics.LastSample().time_ms == 0 ) {
+        metrics.Sample();
+    }
+    const Config::GcMetrics::HeapSample& sample = metrics.LastSample();
+
+    Local<Object> stats = Object::New(isolate);
+    EnvironmentInternal::Set(context, stats, atoms, "now", Config::GcMetrics::NowMillis());
+
+    // gc: pauses per GC type, histograms bucketed by `buckets` upper bounds.
+    Local<Object> gc = Object::New(isolate);
+    for (int kind = 0; kind < Config::GcMetrics::kGcKindCount; kind++) {
+        EnvironmentInternal::Set(
+                context, gc, atoms,
+                Config::GcMetrics::GcKindName(static_cast<Config::GcMetrics::GcKind>(kind)),
+                EnvironmentInternal::PauseStatistics(
+                        context, atoms, metrics.Pauses(static_cast<Config::GcMetrics::GcKind>(kind))));
+    }
+    EnvironmentInternal::Set(context, stats, atoms, "gc", gc);
+
+    Local<Array> buckets = Array::New(isolate, Config::GcMetrics::kBucketCount - 1);
+    for (size_t i = 0; i < Config::GcMetrics::kBucketCount - 1; i++) {
+        buckets->Set(context, static_cast<uint32_t>(i),
+                     Number::New(isolate, Config::GcMetrics::kBucketBounds[i])).FromJust();
+    }
+    EnvironmentInternal::Set(context, stats, atoms, "buckets", buckets);
+
+    // heap: last sample.
+    Local<Object> heap = Object::New(isolate);
+    EnvironmentInternal::Set(context, heap, atoms, "sampledAt", sample.time_ms);
+    EnvironmentInternal::Set(context, heap, atoms, "totalHeapSize", static_cast<double>(sample.total_heap_size));
+    EnvironmentInternal::Set(context, heap, atoms, "totalPhysicalSize", static_cast<double>(sample.total_physical_size));
+    EnvironmentInternal::Set(context, heap, atoms, "usedHeapSize", static_cast<double>(sample.used_heap_size));
+    EnvironmentInternal::Set(context, heap, atoms, "heapSizeLimit", static_cast<double>(sample.heap_size_limit));
+    EnvironmentInternal::Set(context, heap, atoms, "mallocedMemory", static_cast<double>(sample.malloced_memory));
+
+    Local<Object> spaces = Object::New(isolate);
+    for (const Config::GcMetrics::SpaceSample& space : sample.spaces) {
+        Local<Object> object = Object::New(isolate);
+        EnvironmentInternal::Set(context, object, atoms, "size", static_cast<double>(space.size));
+        EnvironmentInternal::Set(context, object, atoms, "used", static_cast<double>(space.used));
+        EnvironmentInternal::Set(context, object, atoms, "available", static_cast<double>(space.available));
+        EnvironmentInternal::Set(context, object, atoms, "physical", static_cast<double>(space.physical));
+        EnvironmentInternal::Set(context, spaces, atoms, space.name, object);
+    }
+    EnvironmentInternal::Set(context, heap, atoms, "spaces", spaces);
+    EnvironmentInternal::Set(context, stats, atoms, "heap", heap);
+
+    info.GetReturnValue().Set( stats );
+}
+
+Local<ObjectTemplate> Environment::GlobalTemplate(Isolate* isolate) {
+
+    Config::PerIsolateData* data = Config::PerIsolateData::From(isolate);
+
+    Local<ObjectTemplate> global_template = data->FindGlobalTemplate();
+    if (global_template.IsEmpty()) {
+        global_template = CreateGlobalTemplate(isolate);
+        data->SetGlobalTemplate(global_template);
+    }
+
+    return global_template;
+}
+
+Local<ObjectTemplate> Environment::CreateGlobalTemplate(Isolate* isolate) {
+
+    EscapableHandleScope hs(isolate);
+
+    // Create a gloal object template
+    auto global_template = v8::ObjectTemplate::New(isolate);
+
+    global_template->Set(
+            v8::String::NewFromUtf8(isolate, "log"),
+            v8::FunctionTemplate::New(isolate, Environment::Log)
+    );
+
+    global_template->Set(
+            v8::String::NewFromUtf8(isolate, "nativeFactory"),
+            v8::FunctionTemplate::New(isolate, Environment::NativeFactory)
+    );
+
+    global_template->Set(
+            v8::String::NewFromUtf8(isolate, "stats"),
+            v8::FunctionTemplate::New(isolate, Environment::Stats)
+    );
+
+    global_template->Set(
+            v8::String::NewFromUtf8(isolate, "Event"),
+            V8Event::InterfaceTemplate(isolate));
+
+    global_template->Set(
+            v8::String::NewFromUtf8(isolate, "EventTarget"),
+            V8EventTarget::InterfaceTemplate(isolate));
+
+    return hs.Escape(global_template);
+}
+
+const Config::ExternalReferenceTable& Environment::ExternalReferenceTable() {
+
+    static const Config::ExternalReferenceTable table = []() {
+        Config::ExternalReferenceTable table;
+
+        table.Append("global", "log", Environment::Log);
+        table.Append("global", "nativeFactory", Environment::NativeFactory);
+        table.Append("global", "stats", Environment::Stats);
+
+        V8Event::AppendExternalReferences(table);
+        V8EventTarget::AppendExternalReferences(table);
+
+        table.references.push_back(0);
+        return table;
+    }();
+
+    return table;
+}
+
+const intptr_t* Environment::ExternalReferences() {
+    return ExternalReferenceTable().references.data();
+}
+
+uint64_t Environment::ExternalReferencesLayoutHash() {
+    const std::string& layout = ExternalReferenceTable().layout;
+    return CodeCache::Hash(layout.data(), layout.length());
+}
@@ -0,0 +1,70 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_ENVIRONMENT_H
+#define HYPERCASINO_ENVIRONMENT_H
+
+#include <v8.h>
+#include "Configuration.h"
+
+using namespace v8;
+
+/**
+ * The javascript environment every context gets: global functions and binding constructors.
+ * Shared by the main isolate and the snapshot creator, so that both build the same global
+ * template.
+ */
+class Environment {
+public:
+
+    // This class must be static only
+    Environment() = delete;
+
+    Environment(const Environment &) = delete;
+
+    Environment &operator=(const Environment &) = delete;
+
+    /**
+     * Global object template with `log`, `nativeFactory`, `stats` and every binding constructor.
+     */
+    static Local<ObjectTemplate> CreateGlobalTemplate(Isolate *isolate);
+
+    /**
+     * The isolate's global template, created on first use and kept in PerIsolateData. Every
+     * context of the isolate is instantiated from the same template.
+     */
+    static Local<ObjectTemplate> GlobalTemplate(Isolate *isolate);
+
+    /**
+     * Null terminated table of every native callback referenced from templates. Must be passed
+     * both to SnapshotCreator and to Isolate::CreateParams::external_references.
+     */
+    static const intptr_t *ExternalReferences();
+
+    /**
+     * Hash of the names of ExternalReferences, in table order. Identifies the table across
+     * builds.
+     */
+    static uint64_t ExternalReferencesLayoutHash();
+
+    /**
+     * WrapperTypeInfo for a WrapperTypeIndex, or nullptr.
+     */
+    static const Config::WrapperTypeInfo *WrapperTypeInfoAt(size_t index);
+
+    static void Log(const FunctionCallbackInfo<Value> &info);
+
+    static void NativeFactory(const FunctionCallbackInfo<Value> &info);
+
+    /**
+     * `stats()`: GC pauses per type and the last heap sample, see Config::GcMetrics.
+     */
+    static void Stats(const FunctionCallbackInfo<Value> &info);
+
+private:
+
+    static const Config::ExternalReferenceTable &ExternalReferenceTable();
+};
+
+#endif //HYPERCASINO_ENVIRONMENT_H
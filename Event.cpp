@@ -3,18 +3,43 @@
 //
 
 #include "Event.h"
+#include "HeapTracer.h"
+#include "PerIsolateData.h"
 
-Event::Event( const char* event ) : Wrappable(), target(nullptr), currentTarget(nullptr), timeStamp(0L) {
+IMPLEMENT_SLAB_ALLOCATED(Event);
 
-    // naive
-    int len = strlen(event);
-    type = new char[len+1];
+namespace EventInternal {
+
+    template<typename T>
+    void Append(std::string& state, const T& value) {
+        state.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    bool Read(const char*& data, const char* end, T* value) {
+        if ( static_cast<size_t>(end - data) < sizeof(T) ) {
+            return false;
+        }
+        memcpy(value, data, sizeof(T));
+        data += sizeof(T);
+        return true;
+    }
+}
+
+Event::Event( const char* event ) : Wrappable(), target(nullptr), currentTarget(nullptr), timeStamp(0L), defaultPrevented(false),
+                                    payload(nullptr), payloadLength(0) {
+
+    size_t len = strlen(event);
+    type = len < kInlineTypeLength ? inlineType : new char[len+1];
     type[len]= 0;
     memcpy( type, event, len );
 }
 
 Event::~Event() {
-    delete type;
+    if ( type != inlineType ) {
+        delete[] type;
+    }
+    delete[] payload;
 }
 
 const char* Event::Type() const {
@@ -23,4 +48,151 @@ const char* Event::Type() const {
 
 long Event::TimeStamp() const {
     return timeStamp;
+}
+void Event::PreventDefault() {
+    defaultPrevented = true;
+}
+
+bool Event::DefaultPrevented() const {
+    return defaultPrevented;
+}
+
+void Event::AllocatePayload(Isolate* isolate, size_t length) {
+
+    if ( !payloadBuffer.IsEmpty() ) {
+        HandleScope hs(isolate);
+        Local<ArrayBuffer> buffer = payloadBuffer.Get(isolate);
+        if ( buffer->IsNeuterable() ) {
+            buffer->Neuter();
+        }
+        payloadBuffer.Reset();
+    }
+    payloadView.Reset();
+
+    delete[] payload;
+    payload = new double[length]();
+    payloadLength = length;
+
+    UpdateNativeSize(isolate);
+}
+
+double* Event::Payload() const {
+    return payload;
+}
+
+size_t Event::PayloadLength() const {
+    return payloadLength;
+}
+
+Local<Value> Event::PayloadView(Isolate* isolate, Local<Context> context) {
+
+    if ( payload == nullptr ) {
+        return Null(isolate);
+    }
+
+    if ( !payloadView.IsEmpty() ) {
+        return payloadView.Get(isolate);
+    }
+
+    EscapableHandleScope hs(isolate);
+
+    // the view may be gone while script still holds its buffer. Views share one buffer.
+    Local<ArrayBuffer> buffer;
+    if ( !payloadBuffer.IsEmpty() ) {
+        buffer = payloadBuffer.Get(isolate);
+    } else {
+        size_t byteLength = payloadLength * sizeof(double);
+        buffer = ArrayBuffer::New(isolate, payload, byteLength, ArrayBufferCreationMode::kExternalized);
+
+        // the buffer references the wrapper: as long as any view is reachable, this event is too.
+        Local<Private> owner =
+                Config::PerIsolateData::From(isolate)->PrivateSymbol(Config::PerIsolateData::kEventPayload);
+        buffer->SetPrivate(context, owner, Wrap(isolate, context)).FromJust();
+
+        payloadBuffer.Reset(isolate, buffer);
+        payloadBuffer.SetWeak();
+    }
+
+    Local<Float64Array> view = Float64Array::New(buffer, 0, payloadLength);
+    payloadView.Reset(isolate, view);
+    payloadView.SetWeak();
+
+    return hs.Escape(view);
+}
+
+void Event::SerializeInternalFields(std::string& state) const {
+    uint32_t typeLength = static_cast<uint32_t>(strlen(type));
+    EventInternal::Append(state, typeLength);
+    state.append(type, typeLength);
+    EventInternal::Append(state, static_cast<int64_t>(timeStamp));
+    EventInternal::Append(state, static_cast<uint8_t>(defaultPrevented));
+    EventInternal::Append(state, static_cast<uint32_t>(payloadLength));
+    if ( payloadLength > 0 ) {
+        state.append(reinterpret_cast<const char*>(payload), payloadLength * sizeof(double));
+    }
+}
+
+void Event::PrepareForSnapshot(Isolate* isolate) {
+    payloadView.Reset();
+    payloadBuffer.Reset();
+}
+
+size_t Event::NativeSize() const {
+    size_t size = payloadLength * sizeof(double);
+    if ( type != inlineType ) {
+        size += strlen(type) + 1;
+    }
+    return size;
+}
+
+void Event::SetTarget(Isolate* isolate, Local<Context> context, Wrappable* eventTarget) {
+
+    HandleScope hs(isolate);
+
+    Local<Value> targetWrapper = eventTarget != nullptr ?
+                                 Local<Value>(eventTarget->Wrap(isolate, context)) :
+                                 Local<Value>(Null(isolate));
+
+    Local<Private> key = Config::PerIsolateData::From(isolate)->PrivateSymbol(Config::PerIsolateData::kEventTarget);
+    Wrap(isolate, context)->SetPrivate(context, key, targetWrapper).FromJust();
+
+    target = eventTarget;
+}
+
+void Event::Trace(HeapTracer* tracer) const {
+    tracer->Trace(target);
+    tracer->Trace(currentTarget);
+}
+
+Wrappable* Event::Deserialize(const char* data, size_t length) {
+
+    const char* end = data + length;
+
+    uint32_t typeLength;
+    if ( !EventInternal::Read(data, end, &typeLength) || static_cast<size_t>(end - data) < typeLength ) {
+        return nullptr;
+    }
+    std::string eventType(data, typeLength);
+    data += typeLength;
+
+    int64_t eventTimeStamp;
+    uint8_t eventDefaultPrevented;
+    uint32_t eventPayloadLength;
+    if ( !EventInternal::Read(data, end, &eventTimeStamp) ||
+            !EventInternal::Read(data, end, &eventDefaultPrevented) ||
+            !EventInternal::Read(data, end, &eventPayloadLength) ||
+            static_cast<size_t>(end - data) < eventPayloadLength * sizeof(double) ) {
+        return nullptr;
+    }
+
+    Event* event = new Event(eventType.c_str());
+    event->timeStamp = static_cast<long>(eventTimeStamp);
+    event->defaultPrevented = eventDefaultPrevented != 0;
+    if ( eventPayloadLength > 0 ) {
+        event->payload = new double[eventPayloadLength];
+        event->payloadLength = eventPayloadLength;
+        memcpy(event->payload, data, eventPayloadLength * sizeof(double));
+    }
+
+    return event;
 }
\ No newline at end of file
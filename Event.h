@@ -7,6 +7,8 @@
 
 #include <v8.h>
 #include "Wrappable.h"
+#include "SlabAllocator.h"
+#include "EventQueue.h"
 
 using namespace v8;
 
@@ -14,10 +16,12 @@ using namespace v8;
 /**
  * A generic Event.
  * This will be the base class for all other existing events like TouchEvent, SurfaceEvent, etc.
+ * Events carry their own EventQueue link.
  */
-class Event : public Wrappable {
+class Event : public Wrappable, public EventQueue::Node {
 
     DEFINE_WRAPPERTYPEINFO();
+    DEFINE_SLAB_ALLOCATED(Event);
 
 public:
 
@@ -32,13 +36,75 @@ public:
     const char* Type() const;
     long TimeStamp() const;
 
+    void PreventDefault();
+    bool DefaultPrevented() const;
+
+    /**
+     * Numeric payload, for high frequency events with many fields (coordinates, pressure, etc.).
+     * The memory is owned by the Event and exposed to javascript without copies as a
+     * Float64Array over an externalized ArrayBuffer. See PayloadView.
+     * If the current payload was exposed, its ArrayBuffer is neutered before the memory is
+     * freed, so existing views read as empty instead of reading freed memory.
+     */
+    void AllocatePayload(Isolate* isolate, size_t length);
+    double* Payload() const;
+    size_t PayloadLength() const;
+
+    /**
+     * A Float64Array view over the payload, or null when the event has none.
+     * The view keeps the event's wrapper alive, so the native memory outlives it.
+     */
+    Local<Value> PayloadView(Isolate* isolate, Local<Context> context);
+
+    /**
+     * Snapshot support. Type, timeStamp, defaultPrevented and the payload contents survive.
+     * target and currentTarget are native references, and are not kept.
+     */
+    void SerializeInternalFields(std::string& state) const override;
+
+    // payload views are not kept. A view created before the snapshot must not be used after.
+    void PrepareForSnapshot(Isolate* isolate) override;
+
+    static Wrappable* Deserialize(const char* data, size_t length);
+
+    // the type name, when not inline, and the payload.
+    size_t NativeSize() const override;
+
+    // target and currentTarget live as long as the event does.
+    void Trace(HeapTracer* tracer) const override;
+
+    /**
+     * Set the target, and reference its wrapper from the event's wrapper, so the target is
+     * collected only with the event and the target getter never sees a deleted object.
+     * Both are wrapped in the given context if needed.
+     */
+    void SetTarget(Isolate* isolate, Local<Context> context, Wrappable* eventTarget);
+
+    // set through SetTarget.
     Wrappable* target;
     Wrappable* currentTarget;
 
     long timeStamp;
+    // type names up to this length, including the terminator, are stored inline.
+    static const size_t kInlineTypeLength = 24;
+
 protected:
 
+    // points to inlineType, or to a heap copy for longer names.
     char* type;
+    bool defaultPrevented;
+
+    double* payload;
+    size_t payloadLength;
+
+private:
+
+    // weak, so the view does not keep itself alive through the wrapper.
+    Global<Float64Array> payloadView;
+    // weak. The buffer any view of the current payload is built on, to neuter on reallocation.
+    Global<ArrayBuffer> payloadBuffer;
+
+    char inlineType[kInlineTypeLength];
 };
 
 #endif //HYPERCASINO_EVENT_H
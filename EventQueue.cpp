@@ -0,0 +1,151 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <chrono>
+#include "EventQueue.h"
+#include "Event.h"
+#include "EventTarget.h"
+
+namespace EventQueueInternal {
+
+    double NowMillis() {
+        return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+EventQueue::EventQueue() :
+        head_(&stub_),
+        tail_(&stub_),
+        depth_(0),
+        max_depth_(0),
+        pushed_(0),
+        drained_(0),
+        drains_(0),
+        last_drain_ms_(0),
+        max_drain_ms_(0),
+        max_latency_ms_(0),
+        total_latency_ms_(0) {
+}
+
+EventQueue::~EventQueue() {
+    Node* node;
+    while ((node = Pop()) != nullptr) {
+        delete static_cast<Event*>(node);
+    }
+}
+
+void EventQueue::PushNode(Node* node) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+}
+
+void EventQueue::Push(Event* event) {
+
+    Node* node = event;
+    node->enqueued_ms = EventQueueInternal::NowMillis();
+
+    pushed_.fetch_add(1, std::memory_order_relaxed);
+    size_t depth = depth_.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t max_depth = max_depth_.load(std::memory_order_relaxed);
+    while (depth > max_depth &&
+           !max_depth_.compare_exchange_weak(max_depth, depth, std::memory_order_relaxed)) {
+    }
+
+    PushNode(node);
+}
+
+EventQueue::Node* EventQueue::Pop() {
+
+    Node* tail = tail_;
+    Node* next = tail->next.load(std::memory_order_acquire);
+
+    if (tail == &stub_) {
+        if (next == nullptr) {
+            return nullptr;
+        }
+        tail_ = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next != nullptr) {
+        tail_ = next;
+        return tail;
+    }
+
+    // a producer exchanged the head but has not linked its node yet. Try on next drain.
+    if (tail != head_.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    PushNode(&stub_);
+
+    next = tail->next.load(std::memory_order_acquire);
+    if (next != nullptr) {
+        tail_ = next;
+        return tail;
+    }
+
+    return nullptr;
+}
+
+size_t EventQueue::Drain(Isolate* isolate, Local<Context> context, EventTarget* target, size_t max_events) {
+
+    double start = EventQueueInternal::NowMillis();
+
+    batch_.clear();
+
+    Node* node;
+    while (batch_.size() < max_events && (node = Pop()) != nullptr) {
+        batch_.push_back(static_cast<Event*>(node));
+
+        double latency = start - node->enqueued_ms;
+        total_latency_ms_ += latency;
+        if (latency > max_latency_ms_) {
+            max_latency_ms_ = latency;
+        }
+    }
+
+    if (batch_.empty()) {
+        return 0;
+    }
+
+    depth_.fetch_sub(batch_.size(), std::memory_order_relaxed);
+
+    HandleScope hs(isolate);
+
+    Wrappable::WrapAll(isolate, context, batch_.data(), batch_.size());
+
+    for (Wrappable* event : batch_) {
+        // no js caller to report to. Verbose, so listener exceptions reach message listeners.
+        TryCatch try_catch(isolate);
+        try_catch.SetVerbose(true);
+        target->DispatchEvent(isolate, context, static_cast<Event*>(event));
+    }
+
+    drained_ += batch_.size();
+    drains_++;
+    last_drain_ms_ = EventQueueInternal::NowMillis() - start;
+    if (last_drain_ms_ > max_drain_ms_) {
+        max_drain_ms_ = last_drain_ms_;
+    }
+
+    return batch_.size();
+}
+
+EventQueue::Statistics EventQueue::GetStatistics() const {
+    return {
+            depth_.load(std::memory_order_relaxed),
+            max_depth_.load(std::memory_order_relaxed),
+            pushed_.load(std::memory_order_relaxed),
+            drained_,
+            drains_,
+            last_drain_ms_,
+            max_drain_ms_,
+            max_latency_ms_,
+            total_latency_ms_
+    };
+}
@@ -0,0 +1,102 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_EVENTQUEUE_H
+#define HYPERCASINO_EVENTQUEUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <v8.h>
+
+using namespace v8;
+
+class Event;
+class EventTarget;
+class Wrappable;
+
+/**
+ * Lock free, multiple producer single consumer queue of native events.
+ * Input and sensor threads Push events without locking. The isolate thread Drains them in
+ * batches, wrapping and dispatching every pending event under a single HandleScope.
+ *
+ * Intrusive MPSC list after Dmitry Vyukov's design: producers only exchange the head pointer,
+ * the consumer owns the tail. The link lives in the Event itself, so Push allocates nothing.
+ */
+class EventQueue {
+public:
+
+    /**
+     * Queue link, a base of Event. An event is in at most one queue at a time.
+     */
+    struct Node {
+        Node() : next(nullptr), enqueued_ms(0) {}
+
+        std::atomic<Node*> next;
+        double enqueued_ms;
+    };
+
+    struct Statistics {
+        size_t depth;                   // events waiting, at the time of the call.
+        size_t max_depth;
+        uint64_t pushed;
+        uint64_t drained;
+        uint64_t drains;
+        double last_drain_ms;           // time spent in the last Drain.
+        double max_drain_ms;
+        double max_latency_ms;          // worst time from Push to dispatch.
+        double total_latency_ms;        // divide by drained for the average.
+    };
+
+    EventQueue();
+
+    // pending events are deleted.
+    ~EventQueue();
+
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    /**
+     * Enqueue an event. Safe from any thread, and lock free. The queue owns the event until it
+     * is drained.
+     */
+    void Push(Event* event);
+
+    /**
+     * Wrap and dispatch up to max_events pending events to target. Isolate thread only.
+     * @return number of events dispatched.
+     */
+    size_t Drain(Isolate* isolate, Local<Context> context, EventTarget* target, size_t max_events);
+
+    size_t Depth() const { return depth_.load(std::memory_order_relaxed); }
+
+    Statistics GetStatistics() const;
+
+private:
+
+    void PushNode(Node* node);
+    Node* Pop();
+
+    // producers.
+    std::atomic<Node*> head_;
+
+    // consumer.
+    Node* tail_;
+    Node stub_;
+    std::vector<Wrappable*> batch_;
+
+    std::atomic<size_t> depth_;
+    std::atomic<size_t> max_depth_;
+    std::atomic<uint64_t> pushed_;
+
+    // written by the consumer only.
+    uint64_t drained_;
+    uint64_t drains_;
+    double last_drain_ms_;
+    double max_drain_ms_;
+    double max_latency_ms_;
+    double total_latency_ms_;
+};
+
+#endif //HYPERCASINO_EVENTQUEUE_H
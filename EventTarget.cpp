@@ -0,0 +1,176 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include "EventTarget.h"
+#include "Event.h"
+#include "PerIsolateData.h"
+
+namespace EventTargetInternal {
+
+    // { type: [listener, ...], ... }, with a null prototype so any type name is a plain key.
+    Local<Object> ListenersByType(Isolate* isolate, Local<Context> context, Local<Object> wrapper,
+                                  bool create) {
+
+        Local<Private> key =
+                Config::PerIsolateData::From(isolate)->PrivateSymbol(Config::PerIsolateData::kEventTargetListeners);
+        Local<Value> listeners;
+        if (wrapper->GetPrivate(context, key).ToLocal(&listeners) && listeners->IsObject()) {
+            return listeners.As<Object>();
+        }
+
+        if (!create) {
+            return Local<Object>();
+        }
+
+        Local<Object> created = Object::New(isolate);
+        created->SetPrototype(context, Null(isolate)).FromJust();
+        wrapper->SetPrivate(context, key, created).FromJust();
+        return created;
+    }
+
+    Local<Array> CopyListeners(Isolate* isolate, Local<Context> context, Local<Array> listeners,
+                               Local<Function> excluded) {
+
+        uint32_t length = listeners.IsEmpty() ? 0 : listeners->Length();
+        Local<Array> copy = Array::New(isolate, static_cast<int>(length));
+
+        uint32_t index = 0;
+        for (uint32_t i = 0; i < length; i++) {
+            Local<Value> listener = listeners->Get(context, i).ToLocalChecked();
+            if (listener != excluded) {
+                copy->Set(context, index++, listener).FromJust();
+            }
+        }
+
+        return copy;
+    }
+
+    bool Contains(Local<Context> context, Local<Array> listeners, Local<Function> listener) {
+        for (uint32_t i = 0; i < listeners->Length(); i++) {
+            if (listeners->Get(context, i).ToLocalChecked() == listener) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+EventTarget::EventTarget() : Wrappable() {
+}
+
+EventTarget::~EventTarget() {
+}
+
+Local<Array> EventTarget::Listeners(Isolate* isolate, Local<Context> context, const char* type) {
+
+    Local<Object> wrapper = GetWrapper(isolate);
+    if (wrapper.IsEmpty()) {
+        return Local<Array>();
+    }
+
+    Local<Object> listenersByType =
+            EventTargetInternal::ListenersByType(isolate, context, wrapper, false);
+    if (listenersByType.IsEmpty()) {
+        return Local<Array>();
+    }
+
+    Local<Value> listeners;
+    if (!listenersByType->Get(context, Config::PerIsolateData::From(isolate)->Atoms().Get(type))
+            .ToLocal(&listeners) || !listeners->IsArray()) {
+        return Local<Array>();
+    }
+
+    return listeners.As<Array>();
+}
+
+void EventTarget::AddEventListener(Isolate* isolate, const char* type, Local<Function> listener) {
+
+    HandleScope hs(isolate);
+
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<Object> wrapper = Wrap(isolate, context);
+
+    Local<Array> listeners = Listeners(isolate, context, type);
+    if (!listeners.IsEmpty() && EventTargetInternal::Contains(context, listeners, listener)) {
+        return;
+    }
+
+    Local<Array> copy = EventTargetInternal::CopyListeners(isolate, context, listeners, Local<Function>());
+    copy->Set(context, copy->Length(), listener).FromJust();
+
+    EventTargetInternal::ListenersByType(isolate, context, wrapper, true)->CreateDataProperty(
+            context, Config::PerIsolateData::From(isolate)->Atoms().Get(type), copy).FromJust();
+}
+
+void EventTarget::RemoveEventListener(Isolate* isolate, const char* type, Local<Function> listener) {
+
+    HandleScope hs(isolate);
+
+    Local<Context> context = isolate->GetCurrentContext();
+    Local<Array> listeners = Listeners(isolate, context, type);
+    if (listeners.IsEmpty() || !EventTargetInternal::Contains(context, listeners, listener)) {
+        return;
+    }
+
+    Local<Object> listenersByType =
+            EventTargetInternal::ListenersByType(isolate, context, GetWrapper(isolate), false);
+    Local<String> key = Config::PerIsolateData::From(isolate)->Atoms().Get(type);
+
+    if (listeners->Length() == 1) {
+        listenersByType->Delete(context, key).FromJust();
+        return;
+    }
+
+    listenersByType->CreateDataProperty(
+            context, key, EventTargetInternal::CopyListeners(isolate, context, listeners, listener)).FromJust();
+}
+
+bool EventTarget::DispatchEvent(Isolate* isolate, Local<Context> context, Event* event) {
+
+    HandleScope hs(isolate);
+
+    event->SetTarget(isolate, context, this);
+    event->currentTarget = this;
+
+    // never mutated once published, so listeners changing the list don't affect this dispatch.
+    Local<Array> listeners = Listeners(isolate, context, event->Type());
+    if (!listeners.IsEmpty()) {
+
+        Local<Value> receiver = Wrap(isolate, context);
+        Local<Value> argv[] = { event->Wrap(isolate, context) };
+        Local<Value> exception;
+
+        for (uint32_t i = 0; i < listeners->Length(); i++) {
+            Local<Function> listener = listeners->Get(context, i).ToLocalChecked().As<Function>();
+            TryCatch try_catch(isolate);
+            if (listener->Call(context, receiver, 1, argv).IsEmpty() && try_catch.HasCaught()) {
+                if (!try_catch.CanContinue()) {
+                    try_catch.ReThrow();
+                    break;
+                }
+                if (exception.IsEmpty()) {
+                    exception = try_catch.Exception();
+                }
+            }
+        }
+
+        if (!exception.IsEmpty()) {
+            isolate->ThrowException(exception);
+        }
+    }
+
+    event->currentTarget = nullptr;
+
+    return !event->DefaultPrevented();
+}
+
+size_t EventTarget::ListenerCount(Isolate* isolate, const char* type) {
+    HandleScope hs(isolate);
+    Local<Array> listeners = Listeners(isolate, isolate->GetCurrentContext(), type);
+    return listeners.IsEmpty() ? 0 : listeners->Length();
+}
+
+Wrappable* EventTarget::Deserialize(const char* data, size_t length) {
+    return new EventTarget();
+}
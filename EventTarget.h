@@ -0,0 +1,67 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_EVENTTARGET_H
+#define HYPERCASINO_EVENTTARGET_H
+
+#include <v8.h>
+#include "Wrappable.h"
+
+using namespace v8;
+
+class Event;
+
+/**
+ * A native event target.
+ * Listeners are kept per event type in copy on write arrays, so a dispatch iterates a stable
+ * snapshot of the list in one native loop, while listeners added or removed during dispatch
+ * build a new list.
+ * The arrays live in a private property of the target's wrapper, not in native handles, so the
+ * garbage collector sees listeners as ordinary references: a listener whose closure holds the
+ * target does not keep the target, nor its context, alive.
+ */
+class EventTarget : public Wrappable {
+
+    DEFINE_WRAPPERTYPEINFO();
+
+public:
+
+    EventTarget();
+    virtual ~EventTarget();
+
+    // this class disallows copy and assignment to prevent referencing twice the same v8 Persistent
+    // ref.
+    EventTarget(const EventTarget&) = delete;
+    void operator=(const EventTarget&) = delete;
+
+    /**
+     * Adding a listener already registered for the type has no effect.
+     * The target is wrapped in the current context if it has no wrapper yet.
+     */
+    void AddEventListener(Isolate* isolate, const char* type, Local<Function> listener);
+
+    void RemoveEventListener(Isolate* isolate, const char* type, Local<Function> listener);
+
+    /**
+     * Call every listener for the event's type, with this target's wrapper as receiver.
+     * Exceptions thrown by listeners don't stop the dispatch. The first one is rethrown when all
+     * listeners have run.
+     * @return false if any listener called preventDefault.
+     */
+    bool DispatchEvent(Isolate* isolate, Local<Context> context, Event* event);
+
+    size_t ListenerCount(Isolate* isolate, const char* type);
+
+    /**
+     * Snapshot support. Listeners are already part of the wrapper, and are serialized with it.
+     */
+    static Wrappable* Deserialize(const char* data, size_t length);
+
+private:
+
+    // the type's listeners array, or an empty handle when there are none.
+    Local<Array> Listeners(Isolate* isolate, Local<Context> context, const char* type);
+};
+
+#endif //HYPERCASINO_EVENTTARGET_H
@@ -0,0 +1,35 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include "ExternalMemory.h"
+
+Config::ExternalMemory::ExternalMemory(v8::Isolate* isolate) :
+        isolate_(isolate),
+        pending_(0),
+        reported_(0),
+        suspended_(0),
+        types_(kWrapperTypeCount) {
+}
+
+Config::ExternalMemory::~ExternalMemory() {
+    if ( reported_ != 0 ) {
+        isolate_->AdjustAmountOfExternalAllocatedMemory(-reported_);
+    }
+}
+
+void Config::ExternalMemory::Flush() {
+    if ( pending_ != 0 ) {
+        isolate_->AdjustAmountOfExternalAllocatedMemory(pending_);
+        reported_ += pending_;
+        pending_ = 0;
+    }
+}
+
+void Config::ExternalMemory::GetStatistics(std::vector<ExternalMemoryStatistics>& statistics) const {
+    for (const ExternalMemoryStatistics& type : types_) {
+        if ( type.objects != 0 ) {
+            statistics.push_back(type);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_EXTERNALMEMORY_H
+#define HYPERCASINO_EXTERNALMEMORY_H
+
+#include <cstdint>
+#include <vector>
+#include <v8.h>
+#include "Configuration.h"
+
+namespace Config {
+
+    struct ExternalMemoryStatistics {
+        const char* interface_name;
+        int64_t objects;                // wrapped objects accounted for.
+        int64_t bytes;                  // native bytes they own.
+    };
+
+    /**
+     * Native memory owned by wrapped objects, reported to v8 so the GC weighs it when deciding
+     * to collect. See Wrappable::NativeSize.
+     * Changes are aggregated per type, and reported to v8 in batches of kFlushThreshold bytes,
+     * so wrapping and collecting objects doesn't call into v8 for each one.
+     * Owned by PerIsolateData.
+     */
+    class ExternalMemory {
+    public:
+
+        static const int64_t kFlushThreshold = 256 * 1024;
+
+        explicit ExternalMemory(v8::Isolate *isolate);
+
+        // what was reported is given back to v8.
+        ~ExternalMemory();
+
+        ExternalMemory(const ExternalMemory&) = delete;
+        ExternalMemory& operator=(const ExternalMemory&) = delete;
+
+        void Adjust(const WrapperTypeInfo &typeInfo, int64_t bytes, int64_t objects) {
+            if ( typeInfo.index >= types_.size() ) {
+                types_.resize(typeInfo.index + 1);
+            }
+            ExternalMemoryStatistics &type = types_[typeInfo.index];
+            type.interface_name = typeInfo.interface_name;
+            type.bytes += bytes;
+            type.objects += objects;
+
+            pending_ += bytes;
+            if ( suspended_ == 0 && (pending_ >= kFlushThreshold || pending_ <= -kFlushThreshold) ) {
+                Flush();
+            }
+        }
+
+        /**
+         * While suspended, changes are recorded but not reported to v8. For code v8 calls back
+         * where it can't be reentered, like snapshot deserialization. Nests. The last Resume
+         * reports what is pending.
+         */
+        void Suspend() { suspended_++; }
+        void Resume() {
+            if ( --suspended_ == 0 ) {
+                Flush();
+            }
+        }
+
+        /**
+         * Report pending changes to v8 now.
+         */
+        void Flush();
+
+        /**
+         * Per type breakdown, for types with accounted objects.
+         */
+        void GetStatistics(std::vector<ExternalMemoryStatistics> &statistics) const;
+
+        // bytes reported to v8 so far.
+        int64_t Reported() const { return reported_; }
+
+    private:
+
+        v8::Isolate* isolate_;
+
+        int64_t pending_;
+        int64_t reported_;
+        int suspended_;
+
+        // indexed by WrapperTypeInfo::index.
+        std::vector<ExternalMemoryStatistics> types_;
+    };
+}
+
+#endif //HYPERCASINO_EXTERNALMEMORY_H
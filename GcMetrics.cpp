@@ -0,0 +1,143 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <chrono>
+#include "GcMetrics.h"
+
+using namespace v8;
+
+const double Config::GcMetrics::kBucketBounds[kBucketCount - 1] = {0.5, 1, 2, 4, 8, 16, 32, 64};
+
+Config::GcMetrics::GcMetrics(v8::Isolate* isolate) :
+        isolate_(isolate),
+        enabled_(false),
+        sample_interval_ms_(0),
+        pause_start_ms_(),
+        pauses_(),
+        sample_() {
+}
+
+Config::GcMetrics::~GcMetrics() {
+    if ( enabled_ ) {
+        isolate_->RemoveGCPrologueCallback(OnGCPrologue, this);
+        isolate_->RemoveGCEpilogueCallback(OnGCEpilogue, this);
+    }
+}
+
+double Config::GcMetrics::NowMillis() {
+    return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char* Config::GcMetrics::GcKindName(GcKind kind) {
+    switch (kind) {
+        case kScavenge:
+            return "scavenge";
+        case kMarkSweepCompact:
+            return "markSweepCompact";
+        case kIncrementalMarking:
+            return "incrementalMarking";
+        case kProcessWeakCallbacks:
+            return "processWeakCallbacks";
+        default:
+            return "unknown";
+    }
+}
+
+void Config::GcMetrics::Enable(double sample_interval_ms) {
+    sample_interval_ms_ = sample_interval_ms;
+
+    if ( !enabled_ ) {
+        enabled_ = true;
+        isolate_->AddGCPrologueCallback(OnGCPrologue, this);
+        isolate_->AddGCEpilogueCallback(OnGCEpilogue, this);
+    }
+}
+
+int Config::GcMetrics::KindOf(GCType type) {
+    switch (type) {
+        case kGCTypeScavenge:
+            return kScavenge;
+        case kGCTypeMarkSweepCompact:
+            return kMarkSweepCompact;
+        case kGCTypeIncrementalMarking:
+            return kIncrementalMarking;
+        case kGCTypeProcessWeakCallbacks:
+            return kProcessWeakCallbacks;
+        default:
+            return -1;
+    }
+}
+
+void Config::GcMetrics::OnGCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags, void* data) {
+    int kind = KindOf(type);
+    if ( kind >= 0 ) {
+        static_cast<GcMetrics*>(data)->pause_start_ms_[kind] = NowMillis();
+    }
+}
+
+void Config::GcMetrics::OnGCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags, void* data) {
+    int kind = KindOf(type);
+    GcMetrics* metrics = static_cast<GcMetrics*>(data);
+    if ( kind < 0 || metrics->pause_start_ms_[kind] == 0 ) {
+        return;
+    }
+
+    double end = NowMillis();
+    double pause = end - metrics->pause_start_ms_[kind];
+    metrics->pause_start_ms_[kind] = 0;
+
+    PauseStatistics& pauses = metrics->pauses_[kind];
+    pauses.count++;
+    pauses.total_ms += pause;
+    pauses.last_ms = pause;
+    pauses.last_end_ms = end;
+    if ( pause > pauses.max_ms ) {
+        pauses.max_ms = pause;
+    }
+
+    size_t bucket = 0;
+    while ( bucket < kBucketCount - 1 && pause >= kBucketBounds[bucket] ) {
+        bucket++;
+    }
+    pauses.histogram[bucket]++;
+}
+
+bool Config::GcMetrics::MaybeSample() {
+    if ( sample_.time_ms != 0 && NowMillis() - sample_.time_ms < sample_interval_ms_ ) {
+        return false;
+    }
+    Sample();
+    return true;
+}
+
+void Config::GcMetrics::Sample() {
+
+    HeapStatistics heap;
+    isolate_->GetHeapStatistics(&heap);
+
+    sample_.time_ms = NowMillis();
+    sample_.total_heap_size = heap.total_heap_size();
+    sample_.total_physical_size = heap.total_physical_size();
+    sample_.used_heap_size = heap.used_heap_size();
+    sample_.heap_size_limit = heap.heap_size_limit();
+    sample_.malloced_memory = heap.malloced_memory();
+
+    size_t count = isolate_->NumberOfHeapSpaces();
+    sample_.spaces.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        HeapSpaceStatistics space;
+        if ( !isolate_->GetHeapSpaceStatistics(&space, i) ) {
+            sample_.spaces[i] = {"", 0, 0, 0, 0};
+            continue;
+        }
+        sample_.spaces[i] = {
+                space.space_name(),
+                space.space_size(),
+                space.space_used_size(),
+                space.space_available_size(),
+                space.physical_space_size()
+        };
+    }
+}
@@ -0,0 +1,114 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_GCMETRICS_H
+#define HYPERCASINO_GCMETRICS_H
+
+#include <cstdint>
+#include <vector>
+#include <v8.h>
+
+namespace Config {
+
+    /**
+     * GC pauses and heap usage of an isolate.
+     * Once enabled, every collection's pause, prologue to epilogue, is recorded in a histogram
+     * for its GC type, with the time it ended, to correlate frame hitches with collections.
+     * Heap and heap space statistics are sampled by MaybeSample, at most once per interval.
+     *
+     * Available in script as `stats()`, see Environment::Stats.
+     * Owned by PerIsolateData. Isolate thread only.
+     */
+    class GcMetrics {
+    public:
+
+        enum GcKind {
+            kScavenge,
+            kMarkSweepCompact,
+            kIncrementalMarking,
+            kProcessWeakCallbacks,
+            kGcKindCount
+        };
+
+        // histogram bucket upper bounds, in ms. The last bucket is unbounded.
+        static const size_t kBucketCount = 9;
+        static const double kBucketBounds[kBucketCount - 1];
+
+        struct PauseStatistics {
+            uint64_t count;
+            double total_ms;
+            double max_ms;
+            double last_ms;
+            double last_end_ms;         // steady clock time the last pause ended.
+            uint64_t histogram[kBucketCount];
+        };
+
+        struct SpaceSample {
+            const char* name;
+            size_t size;
+            size_t used;
+            size_t available;
+            size_t physical;
+        };
+
+        struct HeapSample {
+            double time_ms;             // steady clock time of the sample. 0 if never sampled.
+            size_t total_heap_size;
+            size_t total_physical_size;
+            size_t used_heap_size;
+            size_t heap_size_limit;
+            size_t malloced_memory;
+            std::vector<SpaceSample> spaces;
+        };
+
+        explicit GcMetrics(v8::Isolate *isolate);
+        ~GcMetrics();
+
+        GcMetrics(const GcMetrics&) = delete;
+        GcMetrics& operator=(const GcMetrics&) = delete;
+
+        /**
+         * Register the GC callbacks.
+         * @param sample_interval_ms minimum time between heap samples.
+         */
+        void Enable(double sample_interval_ms);
+
+        bool Enabled() const { return enabled_; }
+
+        /**
+         * Sample heap statistics if the interval elapsed since the last sample. Once per host
+         * tick.
+         * @return true if sampled.
+         */
+        bool MaybeSample();
+
+        void Sample();
+
+        const PauseStatistics& Pauses(GcKind kind) const { return pauses_[kind]; }
+
+        const HeapSample& LastSample() const { return sample_; }
+
+        static const char* GcKindName(GcKind kind);
+
+        static double NowMillis();
+
+    private:
+
+        static void OnGCPrologue(v8::Isolate *isolate, v8::GCType type, v8::GCCallbackFlags flags, void *data);
+        static void OnGCEpilogue(v8::Isolate *isolate, v8::GCType type, v8::GCCallbackFlags flags, void *data);
+
+        static int KindOf(v8::GCType type);
+
+        v8::Isolate* isolate_;
+        bool enabled_;
+        double sample_interval_ms_;
+
+        double pause_start_ms_[kGcKindCount];
+        PauseStatistics pauses_[kGcKindCount];
+
+        HeapSample sample_;
+    };
+}
+
+#endif //HYPERCASINO_GCMETRICS_H
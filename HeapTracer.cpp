@@ -0,0 +1,130 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <chrono>
+#include "HeapTracer.h"
+#include "Wrappable.h"
+#include "Configuration.h"
+
+namespace HeapTracerInternal {
+
+    // same clock as TaskPlatform::MonotonicallyIncreasingTime, which v8 deadlines are based on.
+    double NowMillis() {
+        return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // reports the native references of every wrapped Wrappable. Old wrappers are visited too:
+    // an old event may be the only reference to a young target.
+    class ReferenceVisitor : public v8::PersistentHandleVisitor {
+    public:
+
+        ReferenceVisitor(v8::Isolate* isolate, HeapTracer* tracer) : isolate_(isolate), tracer_(tracer) {}
+
+        void VisitPersistentHandle(v8::Persistent<v8::Value>* value, uint16_t class_id) override {
+            if (class_id != Config::HC_GARBAGE_COLLECTED_CLASS_ID) {
+                return;
+            }
+
+            v8::HandleScope hs(isolate_);
+            v8::Local<v8::Value> wrapper = v8::Local<v8::Value>::New(isolate_, *value);
+            if (wrapper->IsObject() && wrapper.As<v8::Object>()->InternalFieldCount() >= 2) {
+                Wrappable* wrappable = Config::ToImpl<Wrappable>(wrapper.As<v8::Object>());
+                if (wrappable != nullptr) {
+                    wrappable->Trace(tracer_);
+                }
+            }
+        }
+
+    private:
+
+        v8::Isolate* isolate_;
+        HeapTracer* tracer_;
+    };
+}
+
+HeapTracer::HeapTracer(v8::Isolate* isolate) :
+        isolate_(isolate),
+        scavenging_(false),
+        statistics_() {
+}
+
+void HeapTracer::Trace(const Wrappable* wrappable) {
+    if (wrappable == nullptr) {
+        return;
+    }
+
+    if (scavenging_) {
+        wrappable->MarkWrapperActive();
+        return;
+    }
+
+    if (marked_.insert(wrappable).second) {
+        worklist_.push_back(wrappable);
+    }
+}
+
+void HeapTracer::OnScavengePrologue(v8::Isolate* isolate, v8::GCType type, v8::GCCallbackFlags flags,
+                                    void* data) {
+
+    HeapTracer* tracer = static_cast<HeapTracer*>(data);
+    double start = HeapTracerInternal::NowMillis();
+
+    tracer->scavenging_ = true;
+    HeapTracerInternal::ReferenceVisitor visitor(isolate, tracer);
+    isolate->VisitHandlesWithClassIds(&visitor);
+    tracer->scavenging_ = false;
+
+    tracer->statistics_.scavenges++;
+    tracer->statistics_.last_scavenge_ms = HeapTracerInternal::NowMillis() - start;
+}
+
+void HeapTracer::RegisterV8References(const std::vector<std::pair<void*, void*>>& embedder_fields) {
+    // internal field 0 is the Wrappable, see Wrappable::SetNativeInfo.
+    for (const auto& fields : embedder_fields) {
+        Trace(static_cast<const Wrappable*>(fields.first));
+    }
+}
+
+void HeapTracer::TracePrologue() {
+    marked_.clear();
+    worklist_.clear();
+    statistics_.traces++;
+    statistics_.last_wrappables = 0;
+    statistics_.last_trace_ms = 0;
+}
+
+bool HeapTracer::AdvanceTracing(double deadline_in_ms, AdvanceTracingActions actions) {
+
+    double start = HeapTracerInternal::NowMillis();
+    bool force = actions.force_completion == FORCE_COMPLETION;
+
+    while (!worklist_.empty()) {
+        if (!force && HeapTracerInternal::NowMillis() >= deadline_in_ms) {
+            break;
+        }
+
+        const Wrappable* wrappable = worklist_.back();
+        worklist_.pop_back();
+
+        wrappable->TraceWrapper(isolate_);
+        wrappable->Trace(this);
+
+        statistics_.wrappables++;
+        statistics_.last_wrappables++;
+    }
+
+    statistics_.last_trace_ms += HeapTracerInternal::NowMillis() - start;
+
+    return !worklist_.empty();
+}
+
+void HeapTracer::TraceEpilogue() {
+    marked_.clear();
+}
+
+void HeapTracer::AbortTracing() {
+    marked_.clear();
+    worklist_.clear();
+}
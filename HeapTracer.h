@@ -0,0 +1,91 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_HEAPTRACER_H
+#define HYPERCASINO_HEAPTRACER_H
+
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <v8.h>
+
+class Wrappable;
+
+/**
+ * Traces native references between Wrappables during v8's marking.
+ * v8 reports every live wrapper, and the tracer walks the native graph from its Wrappable
+ * through Wrappable::Trace. Wrappers of every native object reached are marked live, so that
+ * native edges like Event::target keep the target's wrapper, and the target, alive for as long
+ * as the event is reachable. Liveness of the whole graph is decided in the marking pass, and
+ * the wrappers' weak callbacks only finalize what it left unmarked.
+ *
+ * The tracer only runs in full mark-compacts. Scavenges drop young wrappers held only by their
+ * weak handle, so before each scavenge every wrapper reached through a Wrappable::Trace edge is
+ * marked active instead, see OnScavengePrologue. This is conservative: edges from objects about
+ * to die keep their targets for one more scavenge.
+ *
+ * Installed per isolate by PerIsolateData::EnableHeapTracing. Isolate thread only.
+ */
+class HeapTracer : public v8::EmbedderHeapTracer {
+public:
+
+    struct Statistics {
+        uint64_t traces;                // marking cycles.
+        uint64_t wrappables;            // Wrappables traced, over every cycle.
+        size_t last_wrappables;         // Wrappables traced in the last cycle.
+        double last_trace_ms;           // time spent in AdvanceTracing in the last cycle.
+        uint64_t scavenges;
+        double last_scavenge_ms;        // time spent marking wrappers before the last scavenge.
+    };
+
+    explicit HeapTracer(v8::Isolate *isolate);
+    ~HeapTracer() override {}
+
+    HeapTracer(const HeapTracer&) = delete;
+    HeapTracer& operator=(const HeapTracer&) = delete;
+
+    /**
+     * Called from Wrappable::Trace for each native reference. Null references are ignored.
+     */
+    void Trace(const Wrappable *wrappable);
+
+    /**
+     * GC prologue for kGCTypeScavenge, data is the HeapTracer. Installed with the tracer.
+     */
+    static void OnScavengePrologue(v8::Isolate *isolate, v8::GCType type, v8::GCCallbackFlags flags,
+                                   void *data);
+
+    Statistics GetStatistics() const { return statistics_; }
+
+    // v8::EmbedderHeapTracer
+
+    void RegisterV8References(const std::vector<std::pair<void*, void*>>& embedder_fields) override;
+
+    void TracePrologue() override;
+
+    bool AdvanceTracing(double deadline_in_ms, AdvanceTracingActions actions) override;
+
+    void TraceEpilogue() override;
+
+    void EnterFinalPause() override {}
+
+    void AbortTracing() override;
+
+    size_t NumberOfWrappersToTrace() override { return worklist_.size(); }
+
+private:
+
+    v8::Isolate* isolate_;
+
+    // Trace marks wrappers active instead of tracing them.
+    bool scavenging_;
+
+    std::vector<const Wrappable*> worklist_;
+    std::unordered_set<const Wrappable*> marked_;
+
+    Statistics statistics_;
+};
+
+#endif //HYPERCASINO_HEAPTRACER_H
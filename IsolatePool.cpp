@@ -0,0 +1,162 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include "IsolatePool.h"
+#include "PerIsolateData.h"
+#include "Environment.h"
+#include "CodeCache.h"
+#include "TaskPlatform.h"
+
+IsolatePool::IsolatePool(size_t workers, TaskPlatform* platform) :
+        platform_(platform),
+        pending_(0),
+        stopping_(false),
+        next_queue_(0),
+        submitted_(0),
+        completed_(0),
+        stolen_(0) {
+
+    if (workers == 0) {
+        workers = 1;
+    }
+
+    for (size_t i = 0; i < workers; i++) {
+        queues_.emplace_back(new WorkStealingQueue<Job*>());
+    }
+
+    for (size_t i = 0; i < workers; i++) {
+        workers_.emplace_back(&IsolatePool::WorkerMain, this, i);
+    }
+}
+
+IsolatePool::~IsolatePool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wakeup_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::future<IsolatePool::Result> IsolatePool::Run(const std::string& name, const std::string& source) {
+
+    Job* job = new Job();
+    job->name = name;
+    job->source = source;
+    std::future<Result> result = job->result.get_future();
+
+    submitted_++;
+    queues_[next_queue_++ % queues_.size()]->Push(job);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_++;
+    }
+    wakeup_.notify_one();
+
+    return result;
+}
+
+IsolatePool::Statistics IsolatePool::GetStatistics() const {
+    return {workers_.size(), submitted_.load(), completed_.load(), stolen_.load()};
+}
+
+IsolatePool::Job* IsolatePool::Take(size_t index) {
+
+    Job* job;
+    if (queues_[index]->Pop(&job)) {
+        return job;
+    }
+
+    for (size_t i = 1; i < queues_.size(); i++) {
+        if (queues_[(index + i) % queues_.size()]->Steal(&job)) {
+            stolen_++;
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void IsolatePool::WorkerMain(size_t index) {
+
+    Isolate::CreateParams params;
+    std::unique_ptr<ArrayBuffer::Allocator> allocator(ArrayBuffer::Allocator::NewDefaultAllocator());
+    params.array_buffer_allocator = allocator.get();
+
+    Isolate* isolate = Isolate::New(params);
+
+    {
+        Isolate::Scope isolate_scope(isolate);
+        Config::PerIsolateData::Initialize(isolate);
+
+        HandleScope hs(isolate);
+        Local<Context> context = Context::New(isolate, nullptr, Environment::GlobalTemplate(isolate));
+
+        while (true) {
+            Job* job = Take(index);
+
+            if (job == nullptr) {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeup_.wait(lock, [this]() { return stopping_ || pending_ > 0; });
+                if (stopping_ && pending_ == 0) {
+                    break;
+                }
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                pending_--;
+            }
+
+            job->result.set_value(Execute(isolate, context, *job));
+            delete job;
+            completed_++;
+
+            if (platform_ != nullptr) {
+                platform_->PumpMessageLoop(isolate);
+            }
+        }
+
+        Config::PerIsolateData::Dispose(isolate);
+    }
+
+    if (platform_ != nullptr) {
+        platform_->UnregisterIsolate(isolate);
+    }
+    isolate->Dispose();
+}
+
+IsolatePool::Result IsolatePool::Execute(Isolate* isolate, Local<Context> context, const Job& job) {
+
+    HandleScope hs(isolate);
+    Context::Scope context_scope(context);
+    TryCatch try_catch(isolate);
+
+    Local<String> source;
+    Local<Script> script;
+    Local<Value> value;
+
+    bool succeeded =
+            String::NewFromUtf8(isolate, job.source.data(), NewStringType::kNormal,
+                                static_cast<int>(job.source.size())).ToLocal(&source) &&
+            Config::PerIsolateData::From(isolate)->Scripts().Bind(
+                    context, job.name.c_str(), source,
+                    CodeCache::Hash(job.source.data(), job.source.size())).ToLocal(&script) &&
+            script->Run(context).ToLocal(&value);
+
+    if (!succeeded) {
+        if (!try_catch.HasCaught()) {
+            return {false, std::string()};
+        }
+        value = try_catch.Exception();
+    }
+
+    String::Utf8Value utf8(isolate, value);
+    return {succeeded, *utf8 != nullptr ? std::string(*utf8, utf8.length()) : std::string()};
+}
@@ -0,0 +1,103 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_ISOLATEPOOL_H
+#define HYPERCASINO_ISOLATEPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <v8.h>
+#include "WorkStealingQueue.h"
+
+using namespace v8;
+
+class TaskPlatform;
+
+/**
+ * Runs scripts in parallel on a fixed set of isolates.
+ * Every isolate is created, used and disposed on its own worker thread, and gets its own
+ * PerIsolateData and Environment context, so workers share no javascript state.
+ * Jobs are spread round robin over per worker WorkStealingQueues. Idle workers steal.
+ *
+ * Scripts compile once per worker, through the isolate's ScriptCache.
+ */
+class IsolatePool {
+public:
+
+    struct Result {
+        bool succeeded;
+        std::string value;              // result as a string, or the exception message.
+    };
+
+    struct Statistics {
+        size_t workers;
+        uint64_t submitted;
+        uint64_t completed;
+        uint64_t stolen;                // jobs run by a worker other than the one queued to.
+    };
+
+    /**
+     * Start workers threads. V8 must be initialized.
+     * @param platform if not null, workers pump their isolate's foreground tasks after every
+     *      job, and unregister it before disposing it.
+     */
+    explicit IsolatePool(size_t workers, TaskPlatform* platform = nullptr);
+
+    /**
+     * Run every queued job, then dispose the isolates and join the workers.
+     */
+    ~IsolatePool();
+
+    IsolatePool(const IsolatePool&) = delete;
+    IsolatePool& operator=(const IsolatePool&) = delete;
+
+    /**
+     * Queue source to run in a worker's context. Safe from any thread.
+     * @param name script name, the ScriptCache key together with the source hash.
+     */
+    std::future<Result> Run(const std::string& name, const std::string& source);
+
+    size_t Size() const { return workers_.size(); }
+
+    Statistics GetStatistics() const;
+
+private:
+
+    struct Job {
+        std::string name;
+        std::string source;
+        std::promise<Result> result;
+    };
+
+    void WorkerMain(size_t index);
+
+    // own queue first, then steal from the others.
+    Job* Take(size_t index);
+
+    Result Execute(Isolate* isolate, Local<Context> context, const Job& job);
+
+    TaskPlatform* platform_;
+
+    std::vector<std::unique_ptr<WorkStealingQueue<Job*>>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    size_t pending_;                    // guarded by mutex_.
+    bool stopping_;                     // guarded by mutex_.
+
+    std::atomic<size_t> next_queue_;
+    std::atomic<uint64_t> submitted_;
+    std::atomic<uint64_t> completed_;
+    std::atomic<uint64_t> stolen_;
+};
+
+#endif //HYPERCASINO_ISOLATEPOOL_H
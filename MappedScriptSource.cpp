@@ -0,0 +1,279 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "MappedScriptSource.h"
+#include "CodeCache.h"
+
+namespace MappedScriptSourceInternal {
+
+    class MappedOneByteResource : public String::ExternalOneByteStringResource {
+    public:
+
+        MappedOneByteResource(void* mapping, size_t length) :
+                mapping_(mapping),
+                length_(length) {}
+
+        // called from Dispose, when the string is collected or the isolate disposed.
+        ~MappedOneByteResource() override {
+            munmap(mapping_, length_);
+        }
+
+        const char* data() const override { return static_cast<const char*>(mapping_); }
+        size_t length() const override { return length_; }
+
+    private:
+
+        void* mapping_;
+        size_t length_;
+    };
+
+    class MappedTwoByteResource : public String::ExternalStringResource {
+    public:
+
+        MappedTwoByteResource(void* mapping, size_t length) :
+                mapping_(mapping),
+                length_(length) {}
+
+        ~MappedTwoByteResource() override {
+            munmap(mapping_, length_ * sizeof(uint16_t));
+        }
+
+        const uint16_t* data() const override { return static_cast<const uint16_t*>(mapping_); }
+        size_t length() const override { return length_; }
+
+    private:
+
+        void* mapping_;
+        size_t length_;
+    };
+
+    bool IsAscii(const uint8_t* data, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            if (data[i] & 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Decode utf8 into utf16. utf16 must hold length code units, the worst case.
+     * Strict: overlong forms, surrogates, code points over U+10FFFF and truncated sequences are
+     * rejected.
+     * @return false if utf8 is not valid. decoded is set to the decoded code units otherwise.
+     */
+    bool DecodeUtf8(const uint8_t* utf8, size_t length, uint16_t* utf16, size_t* decoded) {
+
+        // smallest code point for each sequence length, anything less is overlong.
+        static const uint32_t kMinimum[] = {0, 0x80, 0x800, 0x10000};
+
+        size_t out = 0;
+        size_t i = 0;
+
+        while (i < length) {
+            uint32_t c = utf8[i];
+            size_t extra;
+
+            if (c < 0x80) {
+                extra = 0;
+            } else if (c >= 0xc2 && c <= 0xdf) {
+                extra = 1;
+            } else if (c >= 0xe0 && c <= 0xef) {
+                extra = 2;
+            } else if (c >= 0xf0 && c <= 0xf4) {
+                extra = 3;
+            } else {
+                // invalid lead byte.
+                return false;
+            }
+
+            if (i + extra >= length) {
+                return false;
+            }
+
+            c &= extra == 0 ? 0x7f : (0x3f >> extra);
+            for (size_t k = 1; k <= extra; k++) {
+                if ((utf8[i + k] & 0xc0) != 0x80) {
+                    return false;
+                }
+                c = (c << 6) | (utf8[i + k] & 0x3f);
+            }
+
+            if (c < kMinimum[extra] || c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff)) {
+                return false;
+            }
+
+            i += extra + 1;
+
+            if (c >= 0x10000) {
+                c -= 0x10000;
+                utf16[out++] = static_cast<uint16_t>(0xd800 + (c >> 10));
+                utf16[out++] = static_cast<uint16_t>(0xdc00 + (c & 0x3ff));
+            } else {
+                utf16[out++] = static_cast<uint16_t>(c);
+            }
+        }
+
+        *decoded = out;
+        return true;
+    }
+
+    // a heap copy. For sources the external string paths can't take.
+    MaybeLocal<String> NewFromUtf8(Isolate* isolate, const uint8_t* utf8, size_t length) {
+        if (length > static_cast<size_t>(String::kMaxLength)) {
+            return MaybeLocal<String>();
+        }
+        return String::NewFromUtf8(isolate, reinterpret_cast<const char*>(utf8),
+                                   NewStringType::kNormal, static_cast<int>(length));
+    }
+
+    MaybeLocal<String> NewTwoByte(Isolate* isolate, const uint8_t* utf8, size_t length) {
+
+        void* mapping = mmap(nullptr, length * sizeof(uint16_t), PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) {
+            return MaybeLocal<String>();
+        }
+
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t mapped = (length * sizeof(uint16_t) + page - 1) / page * page;
+
+        size_t decoded;
+        if (!DecodeUtf8(utf8, length, static_cast<uint16_t*>(mapping), &decoded)) {
+            munmap(mapping, mapped);
+            return NewFromUtf8(isolate, utf8, length);
+        }
+
+        // give back the unused tail, the resource unmaps what it keeps.
+        size_t used = (decoded * sizeof(uint16_t) + page - 1) / page * page;
+        if (used < mapped) {
+            munmap(static_cast<char*>(mapping) + used, mapped - used);
+        }
+
+        // v8 must never see the string change.
+        if (mprotect(mapping, used, PROT_READ) != 0) {
+            munmap(mapping, used);
+            return NewFromUtf8(isolate, utf8, length);
+        }
+
+        MappedTwoByteResource* resource = new MappedTwoByteResource(mapping, decoded);
+        Local<String> source;
+        if (!String::NewExternalTwoByte(isolate, resource).ToLocal(&source)) {
+            delete resource;
+            return MaybeLocal<String>();
+        }
+        return source;
+    }
+
+    // maps the file in place. Only for files nobody can write, whose pages can't change or go
+    // away under the mapping.
+    void* MapContents(int fd, size_t length) {
+
+        void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            return nullptr;
+        }
+
+        // the file may have been made writable and truncated before it was mapped.
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) != length ||
+                (st.st_mode & (S_IWUSR | S_IWGRP | S_IWOTH)) != 0) {
+            munmap(mapping, length);
+            return nullptr;
+        }
+
+        return mapping;
+    }
+
+    // reads the file into a read only anonymous mapping.
+    void* CopyContents(int fd, size_t length) {
+
+        void* mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) {
+            return nullptr;
+        }
+
+        size_t copied = 0;
+        while (copied < length) {
+            ssize_t count = read(fd, static_cast<char*>(mapping) + copied, length - copied);
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count <= 0) {
+                // truncated while reading.
+                munmap(mapping, length);
+                return nullptr;
+            }
+            copied += static_cast<size_t>(count);
+        }
+
+        if (mprotect(mapping, length, PROT_READ) != 0) {
+            munmap(mapping, length);
+            return nullptr;
+        }
+
+        return mapping;
+    }
+}
+
+MaybeLocal<String> MappedScriptSource::Load(Isolate* isolate, const char* path, uint64_t* source_hash) {
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return MaybeLocal<String>();
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return MaybeLocal<String>();
+    }
+
+    size_t length = static_cast<size_t>(st.st_size);
+    if (length == 0) {
+        close(fd);
+        if (source_hash != nullptr) {
+            *source_hash = CodeCache::Hash("", 0);
+        }
+        return String::Empty(isolate);
+    }
+
+    bool writable = (st.st_mode & (S_IWUSR | S_IWGRP | S_IWOTH)) != 0;
+    void* mapping = writable ?
+                    MappedScriptSourceInternal::CopyContents(fd, length) :
+                    MappedScriptSourceInternal::MapContents(fd, length);
+    // a file mapping keeps the file referenced.
+    close(fd);
+
+    if (mapping == nullptr) {
+        return MaybeLocal<String>();
+    }
+
+    const uint8_t* contents = static_cast<const uint8_t*>(mapping);
+    if (source_hash != nullptr) {
+        *source_hash = CodeCache::Hash(static_cast<const char*>(mapping), length);
+    }
+
+    if (!MappedScriptSourceInternal::IsAscii(contents, length)) {
+        MaybeLocal<String> source = MappedScriptSourceInternal::NewTwoByte(isolate, contents, length);
+        munmap(mapping, length);
+        return source;
+    }
+
+    MappedScriptSourceInternal::MappedOneByteResource* resource =
+            new MappedScriptSourceInternal::MappedOneByteResource(mapping, length);
+
+    Local<String> source;
+    if (!String::NewExternalOneByte(isolate, resource).ToLocal(&source)) {
+        delete resource;
+        return MaybeLocal<String>();
+    }
+    return source;
+}
@@ -0,0 +1,36 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_MAPPEDSCRIPTSOURCE_H
+#define HYPERCASINO_MAPPEDSCRIPTSOURCE_H
+
+#include <cstdint>
+#include <v8.h>
+
+using namespace v8;
+
+/**
+ * Script sources backed by memory mapped files, exposed to v8 as external strings, so the
+ * source is never copied onto the javascript heap.
+ * v8 expects external strings never to change. Read only files are mapped in place. Writable
+ * files are read once into a private anonymous mapping, so later writes or truncation can't
+ * change the source or fault under v8.
+ * ASCII contents are used as one byte strings. Other valid utf8 is decoded once into an
+ * anonymous mapping, as two byte strings. Invalid utf8 falls back to a heap string.
+ * The mapping is released when v8 disposes the string resource.
+ */
+class MappedScriptSource {
+public:
+
+    MappedScriptSource() = delete;
+
+    /**
+     * Map path as a javascript string.
+     * @param source_hash if not null, set to CodeCache::Hash of the file contents.
+     * Empty if the file can't be mapped.
+     */
+    static MaybeLocal<String> Load(Isolate* isolate, const char* path, uint64_t* source_hash = nullptr);
+};
+
+#endif //HYPERCASINO_MAPPEDSCRIPTSOURCE_H
@@ -0,0 +1,78 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <chrono>
+#include "MicrotaskScheduler.h"
+#include "PerIsolateData.h"
+
+using namespace v8;
+
+namespace MicrotaskSchedulerInternal {
+
+    double NowMillis() {
+        return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+Config::MicrotaskScheduler::MicrotaskScheduler(v8::Isolate* isolate) :
+        isolate_(isolate),
+        enabled_(false),
+        count_tasks_(false),
+        budget_ms_(0),
+        tasks_(0),
+        statistics_() {
+}
+
+Config::MicrotaskScheduler::~MicrotaskScheduler() {
+    if ( count_tasks_ ) {
+        isolate_->SetPromiseHook(nullptr);
+    }
+}
+
+void Config::MicrotaskScheduler::Enable(double budget_ms, bool count_tasks) {
+    budget_ms_ = budget_ms;
+
+    if ( !enabled_ ) {
+        enabled_ = true;
+        isolate_->SetMicrotasksPolicy(MicrotasksPolicy::kExplicit);
+    }
+
+    if ( count_tasks != count_tasks_ ) {
+        count_tasks_ = count_tasks;
+        isolate_->SetPromiseHook(count_tasks ? OnPromiseHook : nullptr);
+    }
+}
+
+void Config::MicrotaskScheduler::OnPromiseHook(PromiseHookType type,
+                                               Local<Promise> promise,
+                                               Local<Value> parent) {
+    if ( type == PromiseHookType::kAfter ) {
+        PerIsolateData::From(promise->GetIsolate())->Microtasks().tasks_++;
+    }
+}
+
+uint64_t Config::MicrotaskScheduler::Drain() {
+
+    uint64_t tasks = tasks_;
+    double start = MicrotaskSchedulerInternal::NowMillis();
+
+    isolate_->RunMicrotasks();
+
+    double elapsed = MicrotaskSchedulerInternal::NowMillis() - start;
+    tasks = tasks_ - tasks;
+
+    statistics_.drains++;
+    statistics_.tasks += tasks;
+    statistics_.last_drain_ms = elapsed;
+    statistics_.total_drain_ms += elapsed;
+    if ( elapsed > statistics_.max_drain_ms ) {
+        statistics_.max_drain_ms = elapsed;
+    }
+    if ( elapsed > budget_ms_ ) {
+        statistics_.over_budget++;
+    }
+
+    return tasks;
+}
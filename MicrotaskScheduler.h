@@ -0,0 +1,77 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_MICROTASKSCHEDULER_H
+#define HYPERCASINO_MICROTASKSCHEDULER_H
+
+#include <cstdint>
+#include <v8.h>
+
+namespace Config {
+
+    /**
+     * Explicit microtask policy for an isolate.
+     * Once enabled, v8 no longer runs microtasks when the script call depth drops to zero, so
+     * promise continuations never run in the middle of native callbacks. They are batched and
+     * run once per host tick, by Drain.
+     *
+     * RunMicrotasks can't be interrupted, so the budget is not enforced: a drain runs the whole
+     * queue, and the ones exceeding the budget are counted.
+     * Tasks are promise reaction jobs. Counting them needs a PromiseHook, which makes every
+     * promise operation call into native code, so it is opt in, for diagnostics.
+     * Owned by PerIsolateData.
+     */
+    class MicrotaskScheduler {
+    public:
+
+        struct Statistics {
+            uint64_t drains;
+            uint64_t tasks;             // 0 unless counting tasks.
+            uint64_t over_budget;       // drains that took longer than the budget.
+            double last_drain_ms;
+            double max_drain_ms;
+            double total_drain_ms;
+        };
+
+        explicit MicrotaskScheduler(v8::Isolate *isolate);
+        ~MicrotaskScheduler();
+
+        MicrotaskScheduler(const MicrotaskScheduler&) = delete;
+        MicrotaskScheduler& operator=(const MicrotaskScheduler&) = delete;
+
+        /**
+         * Switch the isolate to MicrotasksPolicy::kExplicit.
+         * @param budget_ms per drain time budget.
+         * @param count_tasks install a PromiseHook to count tasks. Slows down promises.
+         */
+        void Enable(double budget_ms, bool count_tasks = false);
+
+        bool Enabled() const { return enabled_; }
+
+        /**
+         * Run every pending microtask, including the ones they enqueue. Once per host tick,
+         * outside of any script.
+         * @return tasks run, if counting tasks.
+         */
+        uint64_t Drain();
+
+        Statistics GetStatistics() const { return statistics_; }
+
+    private:
+
+        static void OnPromiseHook(v8::PromiseHookType type,
+                                  v8::Local<v8::Promise> promise,
+                                  v8::Local<v8::Value> parent);
+
+        v8::Isolate* isolate_;
+        bool enabled_;
+        bool count_tasks_;
+        double budget_ms_;
+
+        uint64_t tasks_;
+        Statistics statistics_;
+    };
+}
+
+#endif //HYPERCASINO_MICROTASKSCHEDULER_H
@@ -0,0 +1,203 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <climits>
+#include <cstdlib>
+#include "ModuleLoader.h"
+#include "MappedScriptSource.h"
+#include "Configuration.h"
+
+namespace ModuleLoaderInternal {
+
+    bool IsFileSpecifier(const std::string& specifier) {
+        return specifier.compare(0, 1, "/") == 0 ||
+               specifier.compare(0, 2, "./") == 0 ||
+               specifier.compare(0, 3, "../") == 0;
+    }
+
+    std::string Directory(const std::string& path) {
+        size_t slash = path.find_last_of('/');
+        return slash == std::string::npos ? std::string(".") : path.substr(0, slash);
+    }
+
+    void ThrowError(Isolate* isolate, const std::string& message) {
+        isolate->ThrowException(Exception::Error(String::NewFromUtf8(isolate, message.c_str())));
+    }
+}
+
+ModuleLoader::ModuleLoader(Isolate* isolate, Local<Context> context) :
+        isolate_(isolate),
+        context_(isolate, context),
+        compiled_(0),
+        reused_(0) {
+    context->SetAlignedPointerInEmbedderData(Config::HC_MODULE_LOADER_EMBEDDER_INDEX, this);
+}
+
+ModuleLoader::~ModuleLoader() {
+    {
+        HandleScope hs(isolate_);
+        context_.Get(isolate_)->SetAlignedPointerInEmbedderData(Config::HC_MODULE_LOADER_EMBEDDER_INDEX, nullptr);
+    }
+
+    for (auto& module : modules_) {
+        module.second.Reset();
+    }
+    context_.Reset();
+}
+
+ModuleLoader* ModuleLoader::From(Local<Context> context) {
+    return static_cast<ModuleLoader*>(
+            context->GetAlignedPointerFromEmbedderData(Config::HC_MODULE_LOADER_EMBEDDER_INDEX));
+}
+
+void ModuleLoader::RegisterNativeModule(const std::string& specifier, const std::vector<std::string>& globals) {
+
+    // module scope sees the context's globals. `const Event$ = Event; export { Event$ as Event };`
+    std::string source;
+    for (const std::string& name : globals) {
+        source += "const " + name + "$ = " + name + "; export { " + name + "$ as " + name + " };\n";
+    }
+
+    native_sources_[specifier] = source;
+}
+
+MaybeLocal<Object> ModuleLoader::Import(const char* path) {
+
+    EscapableHandleScope hs(isolate_);
+    Local<Context> context = context_.Get(isolate_);
+    Context::Scope context_scope(context);
+
+    std::string canonical;
+    if (!Canonicalize(path, ".", &canonical)) {
+        ModuleLoaderInternal::ThrowError(isolate_, std::string("Cannot find module ") + path);
+        return MaybeLocal<Object>();
+    }
+
+    Local<Module> module;
+    if (!Load(canonical).ToLocal(&module)) {
+        return MaybeLocal<Object>();
+    }
+
+    if (module->GetStatus() == Module::kUninstantiated &&
+            !module->InstantiateModule(context, ResolveModule).FromMaybe(false)) {
+        return MaybeLocal<Object>();
+    }
+
+    if (module->GetStatus() == Module::kInstantiated && module->Evaluate(context).IsEmpty()) {
+        return MaybeLocal<Object>();
+    }
+
+    if (module->GetStatus() == Module::kErrored) {
+        isolate_->ThrowException(module->GetException());
+        return MaybeLocal<Object>();
+    }
+
+    return hs.Escape(module->GetModuleNamespace().As<Object>());
+}
+
+MaybeLocal<Module> ModuleLoader::ResolveModule(Local<Context> context,
+                                               Local<String> specifier,
+                                               Local<Module> referrer) {
+
+    ModuleLoader* loader = From(context);
+    String::Utf8Value utf8(loader->isolate_, specifier);
+    std::string name(*utf8, utf8.length());
+
+    const std::string* referrer_path = loader->PathOf(referrer);
+
+    std::string canonical;
+    if (referrer_path == nullptr || !loader->Canonicalize(name, *referrer_path, &canonical)) {
+        ModuleLoaderInternal::ThrowError(loader->isolate_, "Cannot find module " + name);
+        return MaybeLocal<Module>();
+    }
+
+    return loader->Load(canonical);
+}
+
+bool ModuleLoader::Canonicalize(const std::string& specifier,
+                                const std::string& referrer_path,
+                                std::string* canonical) const {
+
+    if (!ModuleLoaderInternal::IsFileSpecifier(specifier)) {
+        if (native_sources_.find(specifier) == native_sources_.end()) {
+            return false;
+        }
+        *canonical = specifier;
+        return true;
+    }
+
+    std::string path = specifier[0] == '/' ?
+                       specifier :
+                       ModuleLoaderInternal::Directory(referrer_path) + "/" + specifier;
+
+    char resolved[PATH_MAX];
+    if (realpath(path.c_str(), resolved) == nullptr) {
+        return false;
+    }
+
+    *canonical = resolved;
+    return true;
+}
+
+MaybeLocal<Module> ModuleLoader::Load(const std::string& canonical) {
+
+    auto iter = modules_.find(canonical);
+    if (iter != modules_.end()) {
+        reused_++;
+        return (*iter).second.Get(isolate_);
+    }
+
+    EscapableHandleScope hs(isolate_);
+    Local<String> source;
+
+    auto native = native_sources_.find(canonical);
+    if (native != native_sources_.end()) {
+        source = String::NewFromUtf8(isolate_, (*native).second.c_str());
+    } else if (!MappedScriptSource::Load(isolate_, canonical.c_str()).ToLocal(&source)) {
+        ModuleLoaderInternal::ThrowError(isolate_, "Cannot read module " + canonical);
+        return MaybeLocal<Module>();
+    }
+
+    Local<Module> module;
+    if (!Compile(canonical, source).ToLocal(&module)) {
+        return MaybeLocal<Module>();
+    }
+
+    return hs.Escape(module);
+}
+
+MaybeLocal<Module> ModuleLoader::Compile(const std::string& canonical, Local<String> source) {
+
+    EscapableHandleScope hs(isolate_);
+
+    ScriptOrigin origin(String::NewFromUtf8(isolate_, canonical.c_str()),
+                        Local<Integer>(), Local<Integer>(), Local<Boolean>(), Local<Integer>(),
+                        Local<Value>(), Local<Boolean>(), Local<Boolean>(),
+                        True(isolate_));
+    ScriptCompiler::Source module_source(source, origin);
+
+    Local<Module> module;
+    if (!ScriptCompiler::CompileModule(isolate_, &module_source).ToLocal(&module)) {
+        return MaybeLocal<Module>();
+    }
+
+    compiled_++;
+    modules_.insert(std::make_pair(canonical, Global<Module>(isolate_, module)));
+    paths_.insert(std::make_pair(module->GetIdentityHash(), canonical));
+
+    return hs.Escape(module);
+}
+
+const std::string* ModuleLoader::PathOf(Local<Module> module) const {
+
+    auto range = paths_.equal_range(module->GetIdentityHash());
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        auto entry = modules_.find((*iter).second);
+        if (entry != modules_.end() && (*entry).second == module) {
+            return &(*entry).first;
+        }
+    }
+
+    return nullptr;
+}
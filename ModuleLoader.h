@@ -0,0 +1,95 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_MODULELOADER_H
+#define HYPERCASINO_MODULELOADER_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <v8.h>
+
+using namespace v8;
+
+/**
+ * ES module loader for one context.
+ * Modules are kept in a module map keyed by canonical path: realpath for files, the specifier
+ * for native modules. A module compiles once, however many times, and from wherever, it is
+ * imported.
+ *
+ * Native modules re-export globals installed by Environment, like Event, so that bindings can
+ * be imported: `import { Event } from 'hypercasino';`. This v8 version has no synthetic
+ * modules, so they are generated source modules.
+ *
+ * Module compilation takes no cache options in this v8 version, so there's no code cache for
+ * modules.
+ *
+ * The loader registers itself in the context embedder data, so that v8's resolve callback finds
+ * it. Must outlive module evaluation in the context.
+ */
+class ModuleLoader {
+public:
+
+    struct Statistics {
+        uint64_t compiled;              // modules compiled.
+        uint64_t reused;                // imports resolved from the module map.
+        size_t modules;
+    };
+
+    ModuleLoader(Isolate* isolate, Local<Context> context);
+    ~ModuleLoader();
+
+    ModuleLoader(const ModuleLoader&) = delete;
+    ModuleLoader& operator=(const ModuleLoader&) = delete;
+
+    /**
+     * Make globals importable as named exports of specifier.
+     */
+    void RegisterNativeModule(const std::string& specifier, const std::vector<std::string>& globals);
+
+    /**
+     * Load, instantiate and evaluate the module at path and its imports.
+     * @return the module namespace object, or empty with a pending exception.
+     */
+    MaybeLocal<Object> Import(const char* path);
+
+    Statistics GetStatistics() const { return {compiled_, reused_, modules_.size()}; }
+
+    static ModuleLoader* From(Local<Context> context);
+
+private:
+
+    static MaybeLocal<Module> ResolveModule(Local<Context> context,
+                                            Local<String> specifier,
+                                            Local<Module> referrer);
+
+    /**
+     * Canonical path of specifier imported from referrer_path. Relative and absolute
+     * specifiers are files. Anything else must be a native module.
+     */
+    bool Canonicalize(const std::string& specifier, const std::string& referrer_path, std::string* canonical) const;
+
+    // from the module map, or compiled and added to it.
+    MaybeLocal<Module> Load(const std::string& canonical);
+
+    MaybeLocal<Module> Compile(const std::string& canonical, Local<String> source);
+
+    const std::string* PathOf(Local<Module> module) const;
+
+    Isolate* isolate_;
+    Global<Context> context_;
+
+    std::unordered_map<std::string, Global<Module>> modules_;
+
+    // Module identity hash to canonical path, for resolving relative imports from a referrer.
+    std::unordered_multimap<int, std::string> paths_;
+
+    std::unordered_map<std::string, std::string> native_sources_;
+
+    uint64_t compiled_;
+    uint64_t reused_;
+};
+
+#endif //HYPERCASINO_MODULELOADER_H
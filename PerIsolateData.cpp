@@ -0,0 +1,92 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include "PerIsolateData.h"
+
+using namespace v8;
+
+Config::PerIsolateData::PerIsolateData(v8::Isolate* isolate) :
+        isolate_(isolate),
+        constructor_mode_(kCreateNewObject),
+        atoms_(isolate),
+        scripts_(isolate),
+        microtasks_(isolate),
+        heap_tracer_(isolate),
+        heap_tracing_(false),
+        external_memory_(isolate),
+        gc_metrics_(isolate),
+        interface_templates_(kWrapperTypeCount),
+        wrapper_boilerplates_(kWrapperTypeCount) {
+
+    // registry names. A snapshot's wrappers hold the same symbols.
+    static const char* const kPrivateNames[kPrivateKeyCount] = {
+            "EventTarget::listeners",
+            "Event::target",
+            "Event::payload",
+    };
+
+    HandleScope hs(isolate);
+    for (int i = 0; i < kPrivateKeyCount; i++) {
+        private_keys_[i].Set(isolate, v8::Private::ForApi(isolate, String::NewFromUtf8(isolate, kPrivateNames[i])));
+    }
+}
+
+Config::PerIsolateData::~PerIsolateData() {
+    if ( heap_tracing_ ) {
+        isolate_->RemoveGCPrologueCallback(HeapTracer::OnScavengePrologue, &heap_tracer_);
+        isolate_->SetEmbedderHeapTracer(nullptr);
+    }
+    for (auto& interface_template : interface_templates_) {
+        interface_template.Reset();
+    }
+    for (auto& boilerplate : wrapper_boilerplates_) {
+        boilerplate.Reset();
+    }
+    global_template_.Reset();
+}
+
+Config::PerIsolateData* Config::PerIsolateData::Initialize(v8::Isolate* isolate) {
+    PerIsolateData* data = new PerIsolateData(isolate);
+    isolate->SetData(kIsolateDataSlot, data);
+    return data;
+}
+
+void Config::PerIsolateData::Dispose(v8::Isolate* isolate) {
+    delete From(isolate);
+    isolate->SetData(kIsolateDataSlot, nullptr);
+}
+
+void Config::PerIsolateData::EnableHeapTracing() {
+    if ( !heap_tracing_ ) {
+        heap_tracing_ = true;
+        isolate_->SetEmbedderHeapTracer(&heap_tracer_);
+        isolate_->AddGCPrologueCallback(HeapTracer::OnScavengePrologue, &heap_tracer_, kGCTypeScavenge);
+    }
+}
+
+void Config::PerIsolateData::SetInterfaceTemplate(const WrapperTypeInfo& typeInfo,
+                                                  Local<FunctionTemplate> interface_template) {
+    if ( typeInfo.index >= interface_templates_.size() ) {
+        interface_templates_.resize(typeInfo.index + 1);
+    }
+    interface_templates_[typeInfo.index].Reset(isolate_, interface_template);
+}
+
+void Config::PerIsolateData::SetWrapperBoilerplate(const WrapperTypeInfo& typeInfo,
+                                                   Local<Object> boilerplate) {
+    if ( typeInfo.index >= wrapper_boilerplates_.size() ) {
+        wrapper_boilerplates_.resize(typeInfo.index + 1);
+    }
+    wrapper_boilerplates_[typeInfo.index].Reset(isolate_, boilerplate);
+}
+
+Config::ConstructorModeScope::ConstructorModeScope(v8::Isolate* isolate, ConstructorMode mode) :
+        data_(PerIsolateData::From(isolate)),
+        previous_mode_(data_->constructor_mode_) {
+    data_->constructor_mode_ = mode;
+}
+
+Config::ConstructorModeScope::~ConstructorModeScope() {
+    data_->constructor_mode_ = previous_mode_;
+}
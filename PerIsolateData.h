@@ -0,0 +1,161 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_PERISOLATEDATA_H
+#define HYPERCASINO_PERISOLATEDATA_H
+
+#include <vector>
+#include <v8.h>
+#include "Configuration.h"
+#include "AtomTable.h"
+#include "ScriptCache.h"
+#include "MicrotaskScheduler.h"
+#include "HeapTracer.h"
+#include "ExternalMemory.h"
+#include "GcMetrics.h"
+
+namespace Config {
+
+    /**
+     * Binding state owned by one isolate.
+     * It lives in the isolate data slot kIsolateDataSlot, so that isolates running on different
+     * threads share no mutable state.
+     */
+    class PerIsolateData {
+    public:
+
+        static const uint32_t kIsolateDataSlot = 0;
+
+        // private symbols bindings keep on wrappers.
+        enum PrivateKey {
+            kEventTargetListeners,
+            kEventTarget,
+            kEventPayload,
+            kPrivateKeyCount
+        };
+
+        /**
+         * Create the binding data for an isolate. Must be called once, right after the isolate
+         * is created and before any binding is used.
+         */
+        static PerIsolateData* Initialize(v8::Isolate *);
+
+        /**
+         * Release the binding data and every handle it holds. Must be called before the isolate
+         * is disposed, or serialized by a SnapshotCreator.
+         */
+        static void Dispose(v8::Isolate *);
+
+        static PerIsolateData* From(v8::Isolate *isolate) {
+            return static_cast<PerIsolateData*>(isolate->GetData(kIsolateDataSlot));
+        }
+
+        PerIsolateData(const PerIsolateData&) = delete;
+        PerIsolateData& operator=(const PerIsolateData&) = delete;
+
+        ConstructorMode CurrentConstructorMode() const { return constructor_mode_; }
+
+        AtomTable& Atoms() { return atoms_; }
+
+        // created once per isolate, so hot paths don't allocate a name and search the registry.
+        v8::Local<v8::Private> PrivateSymbol(PrivateKey key) { return private_keys_[key].Get(isolate_); }
+
+        ScriptCache& Scripts() { return scripts_; }
+
+        MicrotaskScheduler& Microtasks() { return microtasks_; }
+
+        /**
+         * Install the isolate's HeapTracer, so that native references between Wrappables take
+         * part in GC marking, and keep their targets through scavenges.
+         */
+        void EnableHeapTracing();
+
+        HeapTracer& Tracer() { return heap_tracer_; }
+
+        ExternalMemory& ExternalMemoryAccounting() { return external_memory_; }
+
+        GcMetrics& Metrics() { return gc_metrics_; }
+
+        // wrap hot path. No allocation, no string comparison.
+        v8::Local<v8::FunctionTemplate> FindInterfaceTemplate(const WrapperTypeInfo &typeInfo) {
+            if ( typeInfo.index < interface_templates_.size() &&
+                    !interface_templates_[typeInfo.index].IsEmpty() ) {
+                return interface_templates_[typeInfo.index].Get(isolate_);
+            }
+            return v8::Local<v8::FunctionTemplate>();
+        }
+
+        void SetInterfaceTemplate(const WrapperTypeInfo &, v8::Local<v8::FunctionTemplate>);
+
+        v8::Local<v8::Object> FindWrapperBoilerplate(const WrapperTypeInfo &typeInfo) {
+            if ( typeInfo.index < wrapper_boilerplates_.size() ) {
+                return wrapper_boilerplates_[typeInfo.index].Get(isolate_);
+            }
+            return v8::Local<v8::Object>();
+        }
+
+        void SetWrapperBoilerplate(const WrapperTypeInfo &, v8::Local<v8::Object>);
+
+        // empty until set. See Environment::GlobalTemplate.
+        v8::Local<v8::ObjectTemplate> FindGlobalTemplate() {
+            return global_template_.Get(isolate_);
+        }
+
+        void SetGlobalTemplate(v8::Local<v8::ObjectTemplate> global_template) {
+            global_template_.Reset(isolate_, global_template);
+        }
+
+    private:
+
+        friend class ConstructorModeScope;
+
+        explicit PerIsolateData(v8::Isolate *);
+        ~PerIsolateData();
+
+        v8::Isolate* isolate_;
+        ConstructorMode constructor_mode_;
+
+        AtomTable atoms_;
+        v8::Eternal<v8::Private> private_keys_[kPrivateKeyCount];
+        ScriptCache scripts_;
+        MicrotaskScheduler microtasks_;
+
+        HeapTracer heap_tracer_;
+        bool heap_tracing_;
+
+        ExternalMemory external_memory_;
+
+        GcMetrics gc_metrics_;
+
+        // indexed by WrapperTypeInfo::index. Grown only when a type outside
+        // kWrapperTypeCount registers.
+        // Globals, not Eternals: they must be released before a SnapshotCreator serializes the
+        // isolate.
+        std::vector<v8::Global<v8::FunctionTemplate>> interface_templates_;
+        std::vector<v8::Global<v8::Object>> wrapper_boilerplates_;
+        v8::Global<v8::ObjectTemplate> global_template_;
+    };
+
+    /**
+     * Set the isolate's constructor mode for the lifetime of this object.
+     * Interface constructors check it to know whether they are wrapping an existing native
+     * object or creating a new one from javascript.
+     */
+    class ConstructorModeScope {
+    public:
+
+        ConstructorModeScope(v8::Isolate *, ConstructorMode);
+        ~ConstructorModeScope();
+
+        ConstructorModeScope(const ConstructorModeScope&) = delete;
+        ConstructorModeScope& operator=(const ConstructorModeScope&) = delete;
+
+    private:
+
+        PerIsolateData* data_;
+        ConstructorMode previous_mode_;
+    };
+}
+
+#endif //HYPERCASINO_PERISOLATEDATA_H
@@ -0,0 +1,158 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <cstdlib>
+#include <cstring>
+#include "PoolingArrayBufferAllocator.h"
+
+Config::PoolingArrayBufferAllocator::PoolingArrayBufferAllocator(const Options& options) :
+        options_(options),
+        size_classes_(),
+        live_bytes_(0),
+        high_water_bytes_(0),
+        cached_bytes_(0),
+        allocations_(0),
+        reused_(0),
+        rejected_(0) {
+}
+
+Config::PoolingArrayBufferAllocator::~PoolingArrayBufferAllocator() {
+    for (SizeClass& size_class : size_classes_) {
+        while (size_class.free_list != nullptr) {
+            FreeBlock* block = size_class.free_list;
+            size_class.free_list = block->next;
+            free(block);
+        }
+    }
+}
+
+size_t Config::PoolingArrayBufferAllocator::SizeClassIndex(size_t length) {
+    if (length > kMaxPooledSize) {
+        return kSizeClassCount;
+    }
+
+    size_t index = 0;
+    while (BlockSize(index) < length) {
+        index++;
+    }
+    return index;
+}
+
+void* Config::PoolingArrayBufferAllocator::Allocate(size_t length) {
+    return Allocate(length, true);
+}
+
+void* Config::PoolingArrayBufferAllocator::AllocateUninitialized(size_t length) {
+    return Allocate(length, options_.zero_fill_uninitialized);
+}
+
+void* Config::PoolingArrayBufferAllocator::Allocate(size_t length, bool zero_fill) {
+
+    size_t index = SizeClassIndex(length);
+    void* data = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (options_.max_live_bytes != 0 && live_bytes_ + length > options_.max_live_bytes) {
+            rejected_++;
+            return nullptr;
+        }
+
+        SizeClass& size_class = size_classes_[index];
+        if (size_class.free_list != nullptr) {
+            FreeBlock* block = size_class.free_list;
+            size_class.free_list = block->next;
+            size_class.cached_blocks--;
+            cached_bytes_ -= BlockSize(index);
+            reused_++;
+            data = block;
+        }
+
+        // accounted before the allocation below, so concurrent allocations respect the cap.
+        allocations_++;
+        size_class.live_blocks++;
+        size_class.live_bytes += length;
+        live_bytes_ += length;
+        if (live_bytes_ > high_water_bytes_) {
+            high_water_bytes_ = live_bytes_;
+        }
+    }
+
+    if (data != nullptr) {
+        if (zero_fill) {
+            memset(data, 0, length);
+        }
+        return data;
+    }
+
+    size_t block_size = index < kSizeClassCount ? BlockSize(index) : (length > 0 ? length : 1);
+    data = zero_fill ? calloc(1, block_size) : malloc(block_size);
+
+    if (data == nullptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        SizeClass& size_class = size_classes_[index];
+        allocations_--;
+        size_class.live_blocks--;
+        size_class.live_bytes -= length;
+        live_bytes_ -= length;
+        rejected_++;
+    }
+
+    return data;
+}
+
+void Config::PoolingArrayBufferAllocator::Free(void* data, size_t length) {
+
+    if (data == nullptr) {
+        return;
+    }
+
+    size_t index = SizeClassIndex(length);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        SizeClass& size_class = size_classes_[index];
+        size_class.live_blocks--;
+        size_class.live_bytes -= length;
+        live_bytes_ -= length;
+
+        if (index < kSizeClassCount && cached_bytes_ + BlockSize(index) <= options_.max_cached_bytes) {
+            FreeBlock* block = static_cast<FreeBlock*>(data);
+            block->next = size_class.free_list;
+            size_class.free_list = block;
+            size_class.cached_blocks++;
+            cached_bytes_ += BlockSize(index);
+            return;
+        }
+    }
+
+    free(data);
+}
+
+Config::ArrayBufferStatistics Config::PoolingArrayBufferAllocator::Statistics() const {
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ArrayBufferStatistics statistics;
+    statistics.live_bytes = live_bytes_;
+    statistics.high_water_bytes = high_water_bytes_;
+    statistics.cached_bytes = cached_bytes_;
+    statistics.allocations = allocations_;
+    statistics.reused = reused_;
+    statistics.rejected = rejected_;
+
+    for (size_t i = 0; i <= kSizeClassCount; i++) {
+        const SizeClass& size_class = size_classes_[i];
+        statistics.size_classes.push_back({
+                i < kSizeClassCount ? BlockSize(i) : 0,
+                size_class.live_blocks,
+                size_class.live_bytes,
+                size_class.cached_blocks
+        });
+    }
+
+    return statistics;
+}
@@ -0,0 +1,112 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_POOLINGARRAYBUFFERALLOCATOR_H
+#define HYPERCASINO_POOLINGARRAYBUFFERALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include <v8.h>
+
+namespace Config {
+
+    struct SizeClassStatistics {
+        size_t block_size;
+        size_t live_blocks;
+        size_t live_bytes;                  // bytes requested by v8, at most live_blocks * block_size.
+        size_t cached_blocks;               // free blocks kept for reuse.
+    };
+
+    struct ArrayBufferStatistics {
+        size_t live_bytes;
+        size_t high_water_bytes;
+        size_t cached_bytes;
+        uint64_t allocations;
+        uint64_t reused;                    // allocations served from a free list.
+        uint64_t rejected;                  // allocations over the hard cap.
+        std::vector<SizeClassStatistics> size_classes;  // the last one is unpooled, larger sizes.
+    };
+
+    /**
+     * ArrayBuffer backing store allocator for scripts churning through short lived typed arrays.
+     * Sizes up to kMaxPooledSize are rounded up to a power of two size class, and freed blocks
+     * are kept in per class free lists, up to max_cached_bytes overall. Larger sizes go straight
+     * to calloc/free.
+     * Allocations that would take live memory over max_live_bytes fail, which v8 surfaces as a
+     * RangeError in script.
+     *
+     * Install it through Isolate::CreateParams::array_buffer_allocator. Must outlive the isolate.
+     * Safe to use from any thread: v8 frees backing stores from GC threads.
+     */
+    class PoolingArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
+    public:
+
+        static const size_t kMinPooledSize = 16;
+        static const size_t kMaxPooledSize = 64 * 1024;
+        static const size_t kSizeClassCount = 13;     // 16 bytes to 64KB.
+
+        struct Options {
+            size_t max_live_bytes;          // hard cap. 0 for none.
+            size_t max_cached_bytes;        // memory kept in free lists.
+            bool zero_fill_uninitialized;   // false lets AllocateUninitialized skip zero fill.
+
+            Options() :
+                    max_live_bytes(0),
+                    max_cached_bytes(8 * 1024 * 1024),
+                    zero_fill_uninitialized(true) {}
+        };
+
+        explicit PoolingArrayBufferAllocator(const Options &options = Options());
+        ~PoolingArrayBufferAllocator() override;
+
+        PoolingArrayBufferAllocator(const PoolingArrayBufferAllocator&) = delete;
+        PoolingArrayBufferAllocator& operator=(const PoolingArrayBufferAllocator&) = delete;
+
+        void* Allocate(size_t length) override;
+
+        void* AllocateUninitialized(size_t length) override;
+
+        void Free(void *data, size_t length) override;
+
+        ArrayBufferStatistics Statistics() const;
+
+    private:
+
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        struct SizeClass {
+            FreeBlock* free_list;
+            size_t live_blocks;
+            size_t live_bytes;
+            size_t cached_blocks;
+        };
+
+        void* Allocate(size_t length, bool zero_fill);
+
+        // kSizeClassCount for unpooled sizes.
+        static size_t SizeClassIndex(size_t length);
+
+        static size_t BlockSize(size_t index) { return kMinPooledSize << index; }
+
+        Options options_;
+
+        mutable std::mutex mutex_;
+
+        // + 1 for the unpooled sizes.
+        SizeClass size_classes_[kSizeClassCount + 1];
+
+        size_t live_bytes_;
+        size_t high_water_bytes_;
+        size_t cached_bytes_;
+        uint64_t allocations_;
+        uint64_t reused_;
+        uint64_t rejected_;
+    };
+}
+
+#endif //HYPERCASINO_POOLINGARRAYBUFFERALLOCATOR_H
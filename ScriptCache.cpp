@@ -0,0 +1,90 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include "ScriptCache.h"
+#include "CodeCache.h"
+
+using namespace v8;
+
+Config::ScriptCache::ScriptCache(v8::Isolate* isolate) :
+        isolate_(isolate),
+        code_cache_(nullptr),
+        hits_(0),
+        misses_(0),
+        evictions_(0) {
+}
+
+Config::ScriptCache::~ScriptCache() {
+    Clear();
+}
+
+void Config::ScriptCache::Clear() {
+    for (auto& script : scripts_) {
+        script.second.script.Reset();
+    }
+    scripts_.clear();
+    lru_.clear();
+}
+
+MaybeLocal<UnboundScript> Config::ScriptCache::Get(const char* name,
+                                                   Local<String> source,
+                                                   uint64_t source_hash) {
+
+    Key key = {name, source_hash};
+
+    auto iter = scripts_.find(key);
+    if ( iter != scripts_.end() ) {
+        hits_++;
+        lru_.splice(lru_.begin(), lru_, (*iter).second.lru);
+        return (*iter).second.script.Get(isolate_);
+    }
+
+    misses_++;
+
+    EscapableHandleScope hs(isolate_);
+
+    ScriptOrigin origin(String::NewFromUtf8(isolate_, name));
+    Local<UnboundScript> script;
+
+    if ( code_cache_ != nullptr ) {
+        if ( !code_cache_->CompileUnbound(isolate_, source, origin, source_hash).ToLocal(&script) ) {
+            return MaybeLocal<UnboundScript>();
+        }
+    } else {
+        ScriptCompiler::Source script_source(source, origin);
+        if ( !ScriptCompiler::CompileUnboundScript(isolate_, &script_source).ToLocal(&script) ) {
+            return MaybeLocal<UnboundScript>();
+        }
+    }
+
+    if ( scripts_.size() >= kMaxEntries ) {
+        auto evicted = scripts_.find(lru_.back());
+        (*evicted).second.script.Reset();
+        scripts_.erase(evicted);
+        lru_.pop_back();
+        evictions_++;
+    }
+
+    lru_.push_front(key);
+    Entry& entry = scripts_[std::move(key)];
+    entry.script.Reset(isolate_, script);
+    entry.lru = lru_.begin();
+
+    return hs.Escape(script);
+}
+
+MaybeLocal<Script> Config::ScriptCache::Bind(Local<Context> context,
+                                             const char* name,
+                                             Local<String> source,
+                                             uint64_t source_hash) {
+
+    Local<UnboundScript> script;
+    if ( !Get(name, source, source_hash).ToLocal(&script) ) {
+        return MaybeLocal<Script>();
+    }
+
+    // BindToCurrentContext binds to the entered context.
+    Context::Scope context_scope(context);
+    return script->BindToCurrentContext();
+}
@@ -0,0 +1,106 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_SCRIPTCACHE_H
+#define HYPERCASINO_SCRIPTCACHE_H
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <v8.h>
+
+class CodeCache;
+
+namespace Config {
+
+    /**
+     * Per isolate cache of compiled, context independent scripts, keyed by script name and
+     * source hash.
+     * A script compiles once per isolate, and every context binds the same UnboundScript, which
+     * only allocates the closure. Misses compile through the CodeCache, if set.
+     * Handles are released with the cache, see PerIsolateData::Dispose. Past kMaxEntries the
+     * least recently used script is evicted. Meant for named library scripts run in many
+     * contexts, not for one-off sources.
+     * Owned by PerIsolateData.
+     */
+    class ScriptCache {
+    public:
+
+        struct Statistics {
+            uint64_t hits;
+            uint64_t misses;
+            uint64_t evictions;
+            size_t entries;
+        };
+
+        static const size_t kMaxEntries = 128;
+
+        explicit ScriptCache(v8::Isolate *isolate);
+        ~ScriptCache();
+
+        ScriptCache(const ScriptCache&) = delete;
+        ScriptCache& operator=(const ScriptCache&) = delete;
+
+        /**
+         * Find the compiled script for name and source_hash, or compile source.
+         * Empty if source has syntax errors. Failed compilations are not cached.
+         */
+        v8::MaybeLocal<v8::UnboundScript> Get(const char *name,
+                                              v8::Local<v8::String> source,
+                                              uint64_t source_hash);
+
+        /**
+         * Get, bound to context.
+         */
+        v8::MaybeLocal<v8::Script> Bind(v8::Local<v8::Context> context,
+                                        const char *name,
+                                        v8::Local<v8::String> source,
+                                        uint64_t source_hash);
+
+        /**
+         * Persist compiled code across runs. Not owned.
+         */
+        void SetCodeCache(CodeCache *code_cache) { code_cache_ = code_cache; }
+
+        void Clear();
+
+        Statistics GetStatistics() const { return {hits_, misses_, evictions_, scripts_.size()}; }
+
+    private:
+
+        struct Key {
+            std::string name;
+            uint64_t source_hash;
+
+            bool operator==(const Key &other) const {
+                return source_hash == other.source_hash && name == other.name;
+            }
+        };
+
+        struct KeyHash {
+            size_t operator()(const Key &key) const {
+                return std::hash<std::string>()(key.name) ^ static_cast<size_t>(key.source_hash);
+            }
+        };
+
+        struct Entry {
+            v8::Global<v8::UnboundScript> script;
+            std::list<Key>::iterator lru;
+        };
+
+        v8::Isolate* isolate_;
+        CodeCache* code_cache_;
+
+        uint64_t hits_;
+        uint64_t misses_;
+        uint64_t evictions_;
+
+        // most recently used first.
+        std::list<Key> lru_;
+        std::unordered_map<Key, Entry, KeyHash> scripts_;
+    };
+}
+
+#endif //HYPERCASINO_SCRIPTCACHE_H
@@ -0,0 +1,105 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <new>
+#include "SlabAllocator.h"
+
+namespace SlabAllocatorInternal {
+
+    size_t SlotSize(size_t object_size) {
+        const size_t alignment = alignof(std::max_align_t);
+        if (object_size < sizeof(void*)) {
+            object_size = sizeof(void*);
+        }
+        return (object_size + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+std::atomic<Config::SlabAllocator*> Config::SlabAllocator::first_allocator_(nullptr);
+
+Config::SlabAllocator::SlabAllocator(const char* name, size_t object_size) :
+        name_(name),
+        // objects hold the free list link while free.
+        object_size_(SlabAllocatorInternal::SlotSize(object_size)),
+        free_list_(nullptr),
+        live_objects_(0),
+        next_allocator_(first_allocator_.load(std::memory_order_relaxed)) {
+
+    // allocators of different classes may be created concurrently, on their first use.
+    while (!first_allocator_.compare_exchange_weak(next_allocator_, this, std::memory_order_release,
+                                                   std::memory_order_relaxed)) {
+    }
+}
+
+Config::SlabAllocator::~SlabAllocator() {
+    for (char* slab : slabs_) {
+        ::operator delete(slab);
+    }
+}
+
+void Config::SlabAllocator::NewSlab() {
+    char* slab = static_cast<char*>(::operator new(object_size_ * kObjectsPerSlab));
+    slabs_.push_back(slab);
+
+    for (size_t i = kObjectsPerSlab; i > 0; i--) {
+        FreeObject* object = reinterpret_cast<FreeObject*>(slab + (i - 1) * object_size_);
+        object->next = free_list_;
+        free_list_ = object;
+    }
+}
+
+void* Config::SlabAllocator::Allocate(size_t size) {
+
+    if (size > object_size_) {
+        return ::operator new(size);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (free_list_ == nullptr) {
+        NewSlab();
+    }
+
+    FreeObject* object = free_list_;
+    free_list_ = object->next;
+    live_objects_++;
+
+    return object;
+}
+
+void Config::SlabAllocator::Free(void* ptr, size_t size) {
+
+    if (ptr == nullptr) {
+        return;
+    }
+
+    if (size > object_size_) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    FreeObject* object = static_cast<FreeObject*>(ptr);
+    object->next = free_list_;
+    free_list_ = object;
+    live_objects_--;
+}
+
+Config::SlabStatistics Config::SlabAllocator::Statistics() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {
+            name_,
+            object_size_,
+            live_objects_,
+            slabs_.size(),
+            slabs_.size() * kObjectsPerSlab
+    };
+}
+
+void Config::SlabAllocator::GetStatistics(std::vector<SlabStatistics>& statistics) {
+    for (SlabAllocator* allocator = first_allocator_.load(std::memory_order_acquire); allocator != nullptr; allocator = allocator->next_allocator_) {
+        statistics.push_back(allocator->Statistics());
+    }
+}
@@ -0,0 +1,100 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_SLABALLOCATOR_H
+#define HYPERCASINO_SLABALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace Config {
+
+    struct SlabStatistics {
+        const char* name;
+        size_t object_size;
+        size_t live_objects;
+        size_t slab_count;
+        size_t capacity;                    // objects fitting in all slabs.
+
+        double Occupancy() const {
+            return capacity ? static_cast<double>(live_objects) / capacity : 0;
+        }
+    };
+
+    /**
+     * Fixed size object allocator.
+     * Objects are carved from slabs of kObjectsPerSlab and recycled through an intrusive free
+     * list. Slabs are kept for the lifetime of the process, so pools must be sized from
+     * GetStatistics.
+     * Safe to use from any thread.
+     *
+     * Wrappable subclasses opt in with DEFINE_SLAB_ALLOCATED. Subclasses not defining their own
+     * allocator have a different size, and fall back to the global operator new.
+     * Class allocators are created on first use and never destroyed, so objects may be deleted
+     * from any static destructor regardless of translation unit order.
+     */
+    class SlabAllocator {
+    public:
+
+        static const size_t kObjectsPerSlab = 64;
+
+        SlabAllocator(const char* name, size_t object_size);
+        ~SlabAllocator();
+
+        SlabAllocator(const SlabAllocator&) = delete;
+        SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+        void* Allocate(size_t size);
+        void Free(void* ptr, size_t size);
+
+        SlabStatistics Statistics();
+
+        /**
+         * Statistics for every slab allocator in the process.
+         */
+        static void GetStatistics(std::vector<SlabStatistics>& statistics);
+
+    private:
+
+        struct FreeObject {
+            FreeObject* next;
+        };
+
+        void NewSlab();
+
+        const char* name_;
+        size_t object_size_;
+
+        std::mutex mutex_;
+        FreeObject* free_list_;
+        std::vector<char*> slabs_;
+        size_t live_objects_;
+
+        // registry of allocators. Allocators register on creation, from any thread.
+        SlabAllocator* next_allocator_;
+        static std::atomic<SlabAllocator*> first_allocator_;
+    };
+}
+
+#define DEFINE_SLAB_ALLOCATED(Class)                                    \
+    public:                                                             \
+        static void* operator new(size_t size) {                        \
+            return GetSlabAllocator().Allocate(size);                   \
+        }                                                               \
+        static void operator delete(void* ptr, size_t size) {          \
+            GetSlabAllocator().Free(ptr, size);                         \
+        }                                                               \
+    private:                                                            \
+        static Config::SlabAllocator& GetSlabAllocator()
+
+#define IMPLEMENT_SLAB_ALLOCATED(Class)                                 \
+    Config::SlabAllocator& Class::GetSlabAllocator() {                  \
+        static Config::SlabAllocator* allocator =                       \
+                new Config::SlabAllocator(#Class, sizeof(Class));       \
+        return *allocator;                                              \
+    }
+
+#endif //HYPERCASINO_SLABALLOCATOR_H
@@ -0,0 +1,293 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <cstdio>
+#include <string>
+#include "Snapshot.h"
+#include "Environment.h"
+#include "PerIsolateData.h"
+#include "Wrappable.h"
+#include "CodeCache.h"
+
+namespace SnapshotInternal {
+
+    // blob file header. Guards against blobs from another build: the external references must
+    // match in number and in layout, or callbacks would deserialize as other functions.
+    struct BlobHeader {
+        uint32_t magic;
+        uint32_t version_tag;
+        uint32_t external_references;
+        uint32_t size;
+        uint64_t init_scripts_hash;
+        uint64_t external_references_hash;
+    };
+
+    const uint32_t kBlobMagic = 0x48435333;         // HCS3
+
+    uint32_t ExternalReferenceCount() {
+        uint32_t count = 0;
+        for (const intptr_t* reference = Environment::ExternalReferences(); *reference != 0; reference++) {
+            count++;
+        }
+        return count;
+    }
+
+    // collects the native side of every wrapper alive in the isolate.
+    class WrappableCollector : public PersistentHandleVisitor {
+    public:
+
+        explicit WrappableCollector(Isolate* isolate) : isolate_(isolate) {}
+
+        void VisitPersistentHandle(Persistent<Value>* value, uint16_t class_id) override {
+            if (class_id != Config::HC_GARBAGE_COLLECTED_CLASS_ID) {
+                return;
+            }
+
+            HandleScope hs(isolate_);
+            Local<Value> wrapper = Local<Value>::New(isolate_, *value);
+            if (wrapper->IsObject() && wrapper.As<Object>()->InternalFieldCount() >= 2) {
+                wrappables.push_back(Config::ToImpl<Wrappable>(wrapper.As<Object>()));
+            }
+        }
+
+        std::vector<Wrappable*> wrappables;
+
+    private:
+
+        Isolate* isolate_;
+    };
+
+    bool RunScripts(Isolate* isolate, Local<Context> context,
+                    const char* const* scripts, size_t count) {
+
+        Context::Scope context_scope(context);
+        TryCatch try_catch(isolate);
+
+        for (size_t i = 0; i < count; i++) {
+            Local<String> source = String::NewFromUtf8(isolate, scripts[i]);
+            ScriptOrigin origin(String::NewFromUtf8(isolate, "init"));
+            Local<Script> script;
+            if (!Script::Compile(context, source, &origin).ToLocal(&script) ||
+                    script->Run(context).IsEmpty()) {
+                return false;
+            }
+        }
+
+        isolate->RunMicrotasks();
+        return !try_catch.HasCaught();
+    }
+}
+
+StartupData Snapshot::CreateStartupBlob(const char* const* init_scripts, size_t init_script_count) {
+
+    SnapshotCreator creator(Environment::ExternalReferences());
+    Isolate* isolate = creator.GetIsolate();
+
+    Config::PerIsolateData::Initialize(isolate);
+
+    SnapshotInternal::WrappableCollector collector(isolate);
+    bool initialized;
+
+    {
+        HandleScope hs(isolate);
+
+        // in WrapperTypeIndex order: snapshot template index == WrapperTypeInfo::index.
+        for (size_t i = 0; i < Config::kWrapperTypeCount; i++) {
+            creator.AddTemplate(Environment::WrapperTypeInfoAt(i)->template_function(isolate));
+        }
+
+        Local<ObjectTemplate> global_template = Environment::CreateGlobalTemplate(isolate);
+        creator.AddTemplate(global_template);
+
+        Local<Context> context = Context::New(isolate, nullptr, global_template);
+        initialized = SnapshotInternal::RunScripts(isolate, context, init_scripts, init_script_count);
+
+        creator.SetDefaultContext(context, SerializeInternalFieldsCallback(Snapshot::SerializeInternalFields));
+    }
+
+    // the serializer refuses live global handles. Wrappers keep pointing to their native
+    // objects until the blob is created.
+    isolate->VisitHandlesWithClassIds(&collector);
+    for (Wrappable* wrappable : collector.wrappables) {
+        wrappable->PrepareForSnapshot(isolate);
+        wrappable->ClearWrapper();
+    }
+
+    Config::PerIsolateData::Dispose(isolate);
+
+    StartupData blob = creator.CreateBlob(SnapshotCreator::FunctionCodeHandling::kKeep);
+
+    for (Wrappable* wrappable : collector.wrappables) {
+        delete wrappable;
+    }
+
+    if (!initialized) {
+        delete[] blob.data;
+        return {nullptr, 0};
+    }
+
+    return blob;
+}
+
+uint64_t Snapshot::HashScripts(const char* const* scripts, size_t count) {
+    uint64_t hash = 0;
+    for (size_t i = 0; i < count; i++) {
+        hash = hash * 31 + CodeCache::Hash(scripts[i], strlen(scripts[i]));
+    }
+    return hash;
+}
+
+bool Snapshot::ReadBlob(const char* path, StartupData* blob, uint64_t init_scripts_hash) {
+
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    SnapshotInternal::BlobHeader header;
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 &&
+                 header.magic == SnapshotInternal::kBlobMagic &&
+                 header.version_tag == ScriptCompiler::CachedDataVersionTag() &&
+                 header.external_references == SnapshotInternal::ExternalReferenceCount() &&
+                 header.external_references_hash == Environment::ExternalReferencesLayoutHash() &&
+                 header.init_scripts_hash == init_scripts_hash &&
+                 header.size > 0;
+
+    if (valid) {
+        char* data = new char[header.size];
+        if (fread(data, 1, header.size, file) == header.size) {
+            blob->data = data;
+            blob->raw_size = static_cast<int>(header.size);
+        } else {
+            delete[] data;
+            valid = false;
+        }
+    }
+
+    fclose(file);
+    return valid;
+}
+
+bool Snapshot::WriteBlob(const char* path, const StartupData& blob, uint64_t init_scripts_hash) {
+
+    if (blob.data == nullptr || blob.raw_size <= 0) {
+        return false;
+    }
+
+    SnapshotInternal::BlobHeader header = {
+            SnapshotInternal::kBlobMagic,
+            ScriptCompiler::CachedDataVersionTag(),
+            SnapshotInternal::ExternalReferenceCount(),
+            static_cast<uint32_t>(blob.raw_size),
+            init_scripts_hash,
+            Environment::ExternalReferencesLayoutHash()
+    };
+
+    // processes starting cold may write the blob at the same time.
+    return CodeCache::WriteFile(path, &header, sizeof(header), blob.data, header.size);
+}
+
+StartupData Snapshot::LoadOrCreateBlob(const char* path,
+                                       const char* const* init_scripts,
+                                       size_t init_script_count) {
+
+    uint64_t init_scripts_hash = HashScripts(init_scripts, init_script_count);
+
+    StartupData blob = {nullptr, 0};
+    if (ReadBlob(path, &blob, init_scripts_hash)) {
+        return blob;
+    }
+
+    blob = CreateStartupBlob(init_scripts, init_script_count);
+    WriteBlob(path, blob, init_scripts_hash);
+    return blob;
+}
+
+void Snapshot::RestoreTemplates(Isolate* isolate) {
+
+    HandleScope hs(isolate);
+    Config::PerIsolateData* data = Config::PerIsolateData::From(isolate);
+
+    for (size_t i = 0; i < Config::kWrapperTypeCount; i++) {
+        Local<FunctionTemplate> interface_template;
+        if (FunctionTemplate::FromSnapshot(isolate, i).ToLocal(&interface_template)) {
+            data->SetInterfaceTemplate(*Environment::WrapperTypeInfoAt(i), interface_template);
+        }
+    }
+}
+
+Local<Context> Snapshot::NewContext(Isolate* isolate) {
+
+    EscapableHandleScope hs(isolate);
+
+    // the default context is serialized without its global proxy. It is rebuilt from the
+    // global template.
+    Local<ObjectTemplate> global_template =
+            ObjectTemplate::FromSnapshot(isolate, kGlobalTemplateIndex).ToLocalChecked();
+
+    // DeserializeInternalFields wraps natives while v8 disallows allocation and javascript, so
+    // their memory can't be reported to v8 until the context is built.
+    Config::ExternalMemory& external_memory = Config::PerIsolateData::From(isolate)->ExternalMemoryAccounting();
+    external_memory.Suspend();
+
+    Local<Context> context = Context::New(
+            isolate,
+            nullptr,
+            global_template,
+            MaybeLocal<Value>(),
+            DeserializeInternalFieldsCallback(Snapshot::DeserializeInternalFields));
+
+    external_memory.Resume();
+
+    return hs.Escape(context);
+}
+
+StartupData Snapshot::SerializeInternalFields(Local<Object> holder, int index, void* data) {
+
+    // field 1, the WrapperTypeInfo, is restored from the type index stored with field 0.
+    if (index != 0 || holder->InternalFieldCount() < 2) {
+        return {nullptr, 0};
+    }
+
+    Wrappable* wrappable = Config::ToImpl<Wrappable>(holder);
+    if (wrappable == nullptr) {
+        return {nullptr, 0};
+    }
+
+    const Config::WrapperTypeInfo* wrapper_type_info = wrappable->GetWrapperTypeInfo();
+    if (wrapper_type_info->deserialize == nullptr) {
+        return {nullptr, 0};
+    }
+
+    std::string state(reinterpret_cast<const char*>(&wrapper_type_info->index), sizeof(uint16_t));
+    wrappable->SerializeInternalFields(state);
+
+    // v8 owns the payload, and delete[]s it.
+    char* payload = new char[state.size()];
+    memcpy(payload, state.data(), state.size());
+
+    return {payload, static_cast<int>(state.size())};
+}
+
+void Snapshot::DeserializeInternalFields(Local<Object> holder, int index, StartupData payload, void* data) {
+
+    if (index != 0 || payload.raw_size < static_cast<int>(sizeof(uint16_t))) {
+        return;
+    }
+
+    uint16_t type_index;
+    memcpy(&type_index, payload.data, sizeof(uint16_t));
+
+    const Config::WrapperTypeInfo* wrapper_type_info = Environment::WrapperTypeInfoAt(type_index);
+    if (wrapper_type_info == nullptr || wrapper_type_info->deserialize == nullptr) {
+        return;
+    }
+
+    Wrappable* wrappable = wrapper_type_info->deserialize(
+            payload.data + sizeof(uint16_t), payload.raw_size - sizeof(uint16_t));
+
+    if (wrappable != nullptr) {
+        wrappable->AssociateWithWrapper(holder->GetIsolate(), wrapper_type_info, holder);
+    }
+}
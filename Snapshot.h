@@ -0,0 +1,91 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_SNAPSHOT_H
+#define HYPERCASINO_SNAPSHOT_H
+
+#include <v8.h>
+#include "Configuration.h"
+
+using namespace v8;
+
+/**
+ * Custom startup snapshot with the bindings baked in.
+ *
+ * CreateStartupBlob runs the binding setup once in a SnapshotCreator isolate and serializes the
+ * interface templates, the global template and a default context built from it. Isolates
+ * created with the blob and Environment::ExternalReferences() then deserialize all of it
+ * instead of running setup code:
+ *
+ *   params.snapshot_blob = &blob;
+ *   params.external_references = Environment::ExternalReferences();
+ *   ...
+ *   Config::PerIsolateData::Initialize(isolate);
+ *   Snapshot::RestoreTemplates(isolate);
+ *   Local<Context> context = Snapshot::NewContext(isolate);
+ *
+ * Wrappers in the snapshot are serialized through Wrappable::SerializeInternalFields, and
+ * rebuilt with their WrapperTypeInfo::deserialize.
+ *
+ * A warm snapshot also runs the application's init scripts in the default context before
+ * serializing it, so production contexts start with the bootstrapped object graph, including
+ * the wrappers created during init.
+ */
+class Snapshot {
+public:
+
+    // This class must be static only
+    Snapshot() = delete;
+
+    Snapshot(const Snapshot &) = delete;
+
+    Snapshot &operator=(const Snapshot &) = delete;
+
+    // snapshot template indices. Interface templates are stored at their WrapperTypeIndex.
+    static const size_t kGlobalTemplateIndex = Config::kWrapperTypeCount;
+
+    /**
+     * Create the startup blob, running init_scripts in the default context first.
+     * The caller owns blob.data (delete[]). Returns an empty blob if a script fails.
+     */
+    static StartupData CreateStartupBlob(const char *const *init_scripts = nullptr,
+                                         size_t init_script_count = 0);
+
+    /**
+     * Read a blob written by WriteBlob. Fails if it was written by a different v8 version, a
+     * different set of external references or different init scripts.
+     */
+    static bool ReadBlob(const char *path, StartupData *blob, uint64_t init_scripts_hash = 0);
+
+    static bool WriteBlob(const char *path, const StartupData &blob, uint64_t init_scripts_hash = 0);
+
+    /**
+     * Read the blob at path, or create and write it if missing or stale.
+     * Returns an empty blob if it can't be created.
+     */
+    static StartupData LoadOrCreateBlob(const char *path,
+                                        const char *const *init_scripts = nullptr,
+                                        size_t init_script_count = 0);
+
+    static uint64_t HashScripts(const char *const *scripts, size_t count);
+
+    /**
+     * Register the interface templates deserialized from the blob in the isolate's
+     * PerIsolateData, so bindings don't install them again.
+     */
+    static void RestoreTemplates(Isolate *isolate);
+
+    /**
+     * A new context deserialized from the blob's default context.
+     */
+    static Local<Context> NewContext(Isolate *isolate);
+
+    static StartupData SerializeInternalFields(Local<Object> holder, int index, void *data);
+
+    // runs inside v8's deserializer: must not call back into v8. See NewContext.
+    static void DeserializeInternalFields(Local<Object> holder, int index, StartupData payload,
+                                          void *data);
+};
+
+#endif //HYPERCASINO_SNAPSHOT_H
@@ -0,0 +1,143 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include "StreamingScriptLoader.h"
+
+namespace StreamingScriptLoaderInternal {
+
+    double NowMillis() {
+        return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+/**
+ * Feeds a file to v8 in kBlockSize chunks. GetMoreData is called on the worker thread only.
+ * The full source is kept, since v8 does not build it while streaming and Compile needs it.
+ */
+class StreamingScriptLoader::FileSourceStream : public ScriptCompiler::ExternalSourceStream {
+public:
+
+    explicit FileSourceStream(FILE* file) : file_(file) {}
+
+    ~FileSourceStream() override {
+        Close();
+    }
+
+    size_t GetMoreData(const uint8_t** src) override {
+        if (file_ == nullptr) {
+            return 0;
+        }
+
+        uint8_t* chunk = new uint8_t[kBlockSize];
+        size_t read = fread(chunk, 1, kBlockSize, file_);
+
+        if (read == 0) {
+            delete[] chunk;
+            Close();
+            return 0;
+        }
+
+        source_.append(reinterpret_cast<const char*>(chunk), read);
+
+        // ownership of chunk goes to v8.
+        *src = chunk;
+        return read;
+    }
+
+    const std::string& Source() const { return source_; }
+
+private:
+
+    void Close() {
+        if (file_ != nullptr) {
+            fclose(file_);
+            file_ = nullptr;
+        }
+    }
+
+    FILE* file_;
+    std::string source_;
+};
+
+StreamingScriptLoader::StreamingScriptLoader(Isolate* isolate) :
+        isolate_(isolate),
+        stream_(nullptr),
+        statistics_() {
+}
+
+StreamingScriptLoader::~StreamingScriptLoader() {
+    // the task references source_, it must not outlive it.
+    Join();
+}
+
+bool StreamingScriptLoader::Start(const char* path) {
+
+    if (source_) {
+        return false;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    path_ = path;
+    stream_ = new FileSourceStream(file);
+    source_.reset(new ScriptCompiler::StreamedSource(stream_, ScriptCompiler::StreamedSource::UTF8));
+    task_.reset(ScriptCompiler::StartStreamingScript(isolate_, source_.get()));
+
+    ScriptCompiler::ScriptStreamingTask* task = task_.get();
+    Statistics* statistics = &statistics_;
+    worker_ = std::thread([task, statistics]() {
+        double start = StreamingScriptLoaderInternal::NowMillis();
+        task->Run();
+        statistics->stream_ms = StreamingScriptLoaderInternal::NowMillis() - start;
+    });
+
+    return true;
+}
+
+void StreamingScriptLoader::Join() {
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+MaybeLocal<Script> StreamingScriptLoader::Finish(Local<Context> context) {
+
+    if (!source_) {
+        return MaybeLocal<Script>();
+    }
+
+    double start = StreamingScriptLoaderInternal::NowMillis();
+    Join();
+    double joined = StreamingScriptLoaderInternal::NowMillis();
+
+    const std::string& contents = stream_->Source();
+    statistics_.bytes = contents.size();
+    statistics_.wait_ms = joined - start;
+
+    EscapableHandleScope hs(isolate_);
+
+    Local<String> full_source;
+    if (!String::NewFromUtf8(isolate_, contents.data(), NewStringType::kNormal,
+                             static_cast<int>(contents.size())).ToLocal(&full_source)) {
+        return MaybeLocal<Script>();
+    }
+
+    ScriptOrigin origin(String::NewFromUtf8(isolate_, path_.c_str()));
+
+    Local<Script> script;
+    bool compiled = ScriptCompiler::Compile(context, source_.get(), full_source, origin).ToLocal(&script);
+    statistics_.compile_ms = StreamingScriptLoaderInternal::NowMillis() - joined;
+
+    if (!compiled) {
+        return MaybeLocal<Script>();
+    }
+
+    return hs.Escape(script);
+}
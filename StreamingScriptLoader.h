@@ -0,0 +1,72 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_STREAMINGSCRIPTLOADER_H
+#define HYPERCASINO_STREAMINGSCRIPTLOADER_H
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <v8.h>
+
+using namespace v8;
+
+/**
+ * Loads a script file with v8's streaming compiler.
+ * Start opens the file and parses it on a worker thread while the file is read in blocks. The
+ * isolate thread keeps running and only blocks in Finish, to wait for the parse if still
+ * running, and compile the result in context.
+ *
+ * One script per loader. Start and Finish must be called from the isolate thread.
+ */
+class StreamingScriptLoader {
+public:
+
+    struct Statistics {
+        size_t bytes;                   // source size.
+        double stream_ms;               // read and parse time, on the worker thread.
+        double wait_ms;                 // time Finish blocked waiting for the worker.
+        double compile_ms;              // time Finish spent compiling on the isolate thread.
+    };
+
+    static const size_t kBlockSize = 64 * 1024;
+
+    explicit StreamingScriptLoader(Isolate* isolate);
+    ~StreamingScriptLoader();
+
+    StreamingScriptLoader(const StreamingScriptLoader&) = delete;
+    StreamingScriptLoader& operator=(const StreamingScriptLoader&) = delete;
+
+    /**
+     * Open path and start streaming it. Source is expected in utf8.
+     * @return false if the file can't be opened, or a script is already loading.
+     */
+    bool Start(const char* path);
+
+    /**
+     * Wait for the parse and compile the script in context.
+     * Empty if Start failed, or the script has syntax errors.
+     */
+    MaybeLocal<Script> Finish(Local<Context> context);
+
+    Statistics GetStatistics() const { return statistics_; }
+
+private:
+
+    class FileSourceStream;
+
+    void Join();
+
+    Isolate* isolate_;
+    std::string path_;
+
+    FileSourceStream* stream_;          // owned by source_.
+    std::unique_ptr<ScriptCompiler::StreamedSource> source_;
+    std::unique_ptr<ScriptCompiler::ScriptStreamingTask> task_;
+    std::thread worker_;
+
+    Statistics statistics_;
+};
+
+#endif //HYPERCASINO_STREAMINGSCRIPTLOADER_H
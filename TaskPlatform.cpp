@@ -0,0 +1,248 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include <chrono>
+#include <sched.h>
+#include "TaskPlatform.h"
+
+namespace TaskPlatformInternal {
+
+    double NowSeconds() {
+        return std::chrono::duration<double>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void PinToCpu(size_t cpu) {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+#endif
+    }
+}
+
+TaskPlatform::TaskPlatform(size_t worker_count, bool pin_workers) :
+        pending_(0),
+        stopping_(false),
+        next_queue_(0),
+        statistics_() {
+
+    if (worker_count == 0) {
+        unsigned int cpus = std::thread::hardware_concurrency();
+        worker_count = cpus > 1 ? cpus - 1 : 1;
+    }
+
+    for (size_t i = 0; i < worker_count; i++) {
+        queues_.emplace_back(new WorkStealingQueue<PostedTask>());
+    }
+
+    for (size_t i = 0; i < worker_count; i++) {
+        workers_.emplace_back(&TaskPlatform::WorkerMain, this, i, pin_workers);
+    }
+}
+
+TaskPlatform::~TaskPlatform() {
+    {
+        std::lock_guard<std::mutex> lock(worker_mutex_);
+        stopping_ = true;
+    }
+    wakeup_.notify_all();
+
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+
+    // workers leave as soon as stopping_ is set. Whatever is left was never run.
+    PostedTask posted;
+    for (auto& queue : queues_) {
+        while (queue->Pop(&posted)) {
+            delete posted.task;
+        }
+    }
+
+    for (auto& foreground : foreground_) {
+        DeleteQueue(foreground.second);
+    }
+}
+
+const char* TaskPlatform::TaskKindName(TaskKind kind) {
+    switch (kind) {
+        case kBackgroundShortTask:
+            return "background-short";
+        case kBackgroundLongTask:
+            return "background-long";
+        case kForegroundTask:
+            return "foreground";
+        case kDelayedForegroundTask:
+            return "delayed-foreground";
+        default:
+            return "unknown";
+    }
+}
+
+TaskPlatform::TaskStatistics TaskPlatform::GetStatistics(TaskKind kind) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    return statistics_[kind];
+}
+
+double TaskPlatform::MonotonicallyIncreasingTime() {
+    return TaskPlatformInternal::NowSeconds();
+}
+
+double TaskPlatform::CurrentClockTimeMillis() {
+    return SystemClockTimeMillis();
+}
+
+void TaskPlatform::CallOnBackgroundThread(Task* task, ExpectedRuntime expected_runtime) {
+
+    TaskKind kind = expected_runtime == kLongRunningTask ? kBackgroundLongTask : kBackgroundShortTask;
+    {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        statistics_[kind].posted++;
+    }
+
+    queues_[next_queue_++ % queues_.size()]->Push({task, kind, TaskPlatformInternal::NowSeconds()});
+
+    {
+        std::lock_guard<std::mutex> lock(worker_mutex_);
+        pending_++;
+    }
+    wakeup_.notify_one();
+}
+
+void TaskPlatform::CallOnForegroundThread(Isolate* isolate, Task* task) {
+    {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        statistics_[kForegroundTask].posted++;
+    }
+
+    std::lock_guard<std::mutex> lock(foreground_mutex_);
+    foreground_[isolate].ready.push_back({task, kForegroundTask, TaskPlatformInternal::NowSeconds()});
+}
+
+void TaskPlatform::CallDelayedOnForegroundThread(Isolate* isolate, Task* task, double delay_in_seconds) {
+    {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        statistics_[kDelayedForegroundTask].posted++;
+    }
+
+    std::lock_guard<std::mutex> lock(foreground_mutex_);
+    foreground_[isolate].delayed.push(
+            {task, kDelayedForegroundTask, TaskPlatformInternal::NowSeconds() + delay_in_seconds});
+}
+
+size_t TaskPlatform::PumpMessageLoop(Isolate* isolate) {
+
+    std::deque<PostedTask> tasks;
+    {
+        std::lock_guard<std::mutex> lock(foreground_mutex_);
+        auto iter = foreground_.find(isolate);
+        if (iter == foreground_.end()) {
+            return 0;
+        }
+
+        ForegroundQueue& queue = (*iter).second;
+        double now = TaskPlatformInternal::NowSeconds();
+        while (!queue.delayed.empty() && queue.delayed.top().posted_at <= now) {
+            queue.ready.push_back(queue.delayed.top());
+            queue.delayed.pop();
+        }
+
+        // tasks posted while these run wait for the next pump.
+        tasks.swap(queue.ready);
+    }
+
+    for (const PostedTask& posted : tasks) {
+        Execute(posted);
+    }
+
+    return tasks.size();
+}
+
+void TaskPlatform::UnregisterIsolate(Isolate* isolate) {
+    std::lock_guard<std::mutex> lock(foreground_mutex_);
+    auto iter = foreground_.find(isolate);
+    if (iter != foreground_.end()) {
+        DeleteQueue((*iter).second);
+        foreground_.erase(iter);
+    }
+}
+
+void TaskPlatform::DeleteQueue(ForegroundQueue& queue) {
+    for (const PostedTask& posted : queue.ready) {
+        delete posted.task;
+    }
+    queue.ready.clear();
+
+    while (!queue.delayed.empty()) {
+        delete queue.delayed.top().task;
+        queue.delayed.pop();
+    }
+}
+
+bool TaskPlatform::TakeBackground(size_t index, PostedTask* posted) {
+
+    if (queues_[index]->Pop(posted)) {
+        return true;
+    }
+
+    for (size_t i = 1; i < queues_.size(); i++) {
+        if (queues_[(index + i) % queues_.size()]->Steal(posted)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void TaskPlatform::WorkerMain(size_t index, bool pin) {
+
+    if (pin) {
+        unsigned int cpus = std::thread::hardware_concurrency();
+        TaskPlatformInternal::PinToCpu(cpus > 0 ? index % cpus : 0);
+    }
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(worker_mutex_);
+            wakeup_.wait(lock, [this]() { return stopping_ || pending_ > 0; });
+            if (stopping_) {
+                break;
+            }
+        }
+
+        PostedTask posted;
+        if (!TakeBackground(index, &posted)) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(worker_mutex_);
+            pending_--;
+        }
+
+        Execute(posted);
+    }
+}
+
+void TaskPlatform::Execute(const PostedTask& posted) {
+
+    double start = TaskPlatformInternal::NowSeconds();
+    posted.task->Run();
+    double end = TaskPlatformInternal::NowSeconds();
+
+    delete posted.task;
+
+    double run_ms = (end - start) * 1000;
+
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    TaskStatistics& statistics = statistics_[posted.kind];
+    statistics.executed++;
+    statistics.total_run_ms += run_ms;
+    statistics.total_wait_ms += (start - posted.posted_at) * 1000;
+    if (run_ms > statistics.max_run_ms) {
+        statistics.max_run_ms = run_ms;
+    }
+}
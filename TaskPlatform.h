@@ -0,0 +1,145 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_TASKPLATFORM_H
+#define HYPERCASINO_TASKPLATFORM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <v8.h>
+#include <v8-platform.h>
+#include "WorkStealingQueue.h"
+
+using namespace v8;
+
+/**
+ * v8::Platform replacing platform::CreateDefaultPlatform.
+ * + background tasks (GC, compile) run on a fixed set of workers, fed by per worker
+ *   WorkStealingQueues. Workers can be pinned to a cpu each.
+ * + foreground tasks are queued per isolate, and delayed ones kept in a timer heap. Both only
+ *   run when the isolate thread calls PumpMessageLoop.
+ * + execution statistics per task kind. v8 tasks are opaque, so GC and compile work can't be
+ *   told apart, only how they were posted.
+ *
+ * Must outlive every isolate. Destroy it after V8::ShutdownPlatform: workers are joined, and
+ * tasks not run yet are deleted.
+ */
+class TaskPlatform : public Platform {
+public:
+
+    enum TaskKind {
+        kBackgroundShortTask,
+        kBackgroundLongTask,
+        kForegroundTask,
+        kDelayedForegroundTask,
+        kTaskKindCount
+    };
+
+    struct TaskStatistics {
+        uint64_t posted;
+        uint64_t executed;
+        double total_run_ms;
+        double max_run_ms;
+        double total_wait_ms;           // from post (or deadline, for delayed tasks) to run.
+    };
+
+    /**
+     * @param worker_count background threads. 0 for one per cpu but one, left to the isolate
+     *      thread.
+     * @param pin_workers pin worker i to cpu i % cpus.
+     */
+    explicit TaskPlatform(size_t worker_count = 0, bool pin_workers = false);
+    ~TaskPlatform() override;
+
+    TaskPlatform(const TaskPlatform&) = delete;
+    TaskPlatform& operator=(const TaskPlatform&) = delete;
+
+    /**
+     * Run foreground tasks posted for isolate, and delayed ones that are due. Isolate thread
+     * only.
+     * @return tasks run.
+     */
+    size_t PumpMessageLoop(Isolate* isolate);
+
+    /**
+     * Drop the foreground queues of an isolate about to be disposed.
+     */
+    void UnregisterIsolate(Isolate* isolate);
+
+    TaskStatistics GetStatistics(TaskKind kind) const;
+
+    static const char* TaskKindName(TaskKind kind);
+
+    // v8::Platform
+
+    size_t NumberOfAvailableBackgroundThreads() override { return workers_.size(); }
+
+    void CallOnBackgroundThread(Task* task, ExpectedRuntime expected_runtime) override;
+
+    void CallOnForegroundThread(Isolate* isolate, Task* task) override;
+
+    void CallDelayedOnForegroundThread(Isolate* isolate, Task* task, double delay_in_seconds) override;
+
+    double MonotonicallyIncreasingTime() override;
+
+    double CurrentClockTimeMillis() override;
+
+    TracingController* GetTracingController() override { return &tracing_controller_; }
+
+private:
+
+    struct PostedTask {
+        Task* task;
+        TaskKind kind;
+        double posted_at;               // seconds. Deadline for delayed tasks.
+    };
+
+    struct LaterDeadline {
+        bool operator()(const PostedTask& a, const PostedTask& b) const {
+            return a.posted_at > b.posted_at;
+        }
+    };
+
+    struct ForegroundQueue {
+        std::deque<PostedTask> ready;
+        std::priority_queue<PostedTask, std::vector<PostedTask>, LaterDeadline> delayed;
+    };
+
+    void WorkerMain(size_t index, bool pin);
+
+    bool TakeBackground(size_t index, PostedTask* posted);
+
+    void Execute(const PostedTask& posted);
+
+    static void DeleteQueue(ForegroundQueue& queue);
+
+    // background.
+    std::vector<std::unique_ptr<WorkStealingQueue<PostedTask>>> queues_;
+    std::vector<std::thread> workers_;
+    std::mutex worker_mutex_;
+    std::condition_variable wakeup_;
+    size_t pending_;                    // guarded by worker_mutex_.
+    bool stopping_;                     // guarded by worker_mutex_.
+    std::atomic<size_t> next_queue_;
+
+    // foreground, posted from any thread.
+    std::mutex foreground_mutex_;
+    std::unordered_map<Isolate*, ForegroundQueue> foreground_;
+
+    mutable std::mutex statistics_mutex_;
+    TaskStatistics statistics_[kTaskKindCount];
+
+    TracingController tracing_controller_;
+};
+
+#endif //HYPERCASINO_TASKPLATFORM_H
@@ -5,56 +5,17 @@
 #include "V8Event.h"
 #include "Event.h"
 #include "Configuration.h"
+#include "PerIsolateData.h"
+#include "Bindings.h"
 
 
-
-const int HC_GARBAGE_COLLECTED_CLASS_ID = 16;
-
 namespace V8EventInternal {
 
-    void preventDefault( const FunctionCallbackInfo<Value>& info ) {
-
-    }
-
-    void TypeGetter(const FunctionCallbackInfo<Value> &info) {
-        Event* ev = Config::ToImpl<Event>(info.Holder());
-        if ( ev!= nullptr ) {
-            info.GetReturnValue().Set(String::NewFromUtf8(info.GetIsolate(), ev->Type()));
-        } else {
-            info.GetReturnValue().Set(Null(info.GetIsolate()));
-        }
-    }
-
-    void TimeStampGetter(const FunctionCallbackInfo<Value> &info) {
-        Event* ev = Config::ToImpl<Event>(info.Holder());
-        if ( ev!=nullptr ) {
-            info.GetReturnValue().Set((double) ev->TimeStamp());
-        } else {
-            info.GetReturnValue().Set(Null(info.GetIsolate()));
-        }
-    }
-
-    void TargetGetter(const FunctionCallbackInfo<Value> &info) {
-        Event* ev = Config::ToImpl<Event>(info.Holder());
-        if ( ev!=nullptr ) {
-            if ( ev->target==nullptr ) {
-                info.GetReturnValue().Set(Null(info.GetIsolate()));
-            } else {
-                info.GetReturnValue().Set(ev->target->GetWrapper(info.GetIsolate()));
-            }
-        } else {
-            info.GetReturnValue().Set(Null(info.GetIsolate()));
-        }
-    }
-
-    void CurrentTargetGetter(const FunctionCallbackInfo<Value> &info) {
-        Event* ev = Config::ToImpl<Event>(info.Holder());
+    void DataGetter(const FunctionCallbackInfo<Value> &info) {
+        Event* ev = static_cast<Event*>(Config::ToImpl<Wrappable>(info.Holder()));
         if ( ev!=nullptr ) {
-            if ( ev->currentTarget==nullptr ) {
-                info.GetReturnValue().Set(Null(info.GetIsolate()));
-            } else {
-                info.GetReturnValue().Set(ev->currentTarget->GetWrapper(info.GetIsolate()));
-            }
+            Isolate* isolate = info.GetIsolate();
+            info.GetReturnValue().Set(ev->PayloadView(isolate, isolate->GetCurrentContext()));
         } else {
             info.GetReturnValue().Set(Null(info.GetIsolate()));
         }
@@ -66,20 +27,24 @@ const WrapperTypeInfo V8Event::wrapperTypeInfo = {
         "Event",
         nullptr,
         2,
-        HC_GARBAGE_COLLECTED_CLASS_ID
+        HC_GARBAGE_COLLECTED_CLASS_ID,
+        Config::kEventIndex,
+        Event::Deserialize
 };
 
 const WrapperTypeInfo& Event::wrapperTypeInfo_ = V8Event::wrapperTypeInfo;
 
 static Config::AccessorConfiguration props[] = {
-        {"type",            V8EventInternal::TypeGetter,            nullptr, v8::DontDelete, Config::kOnPrototype},
-        {"timeStamp",       V8EventInternal::TimeStampGetter,       nullptr, v8::DontDelete, Config::kOnPrototype},
-        {"target",          V8EventInternal::TargetGetter,          nullptr, v8::DontDelete, Config::kOnPrototype},
-        {"currentTarget",   V8EventInternal::CurrentTargetGetter,   nullptr, v8::DontDelete, Config::kOnPrototype},
+        {"type",                HC_GETTER(Event, Type),                 nullptr, v8::DontDelete, Config::kOnPrototype},
+        {"timeStamp",           HC_GETTER(Event, TimeStamp),            nullptr, v8::DontDelete, Config::kOnPrototype},
+        {"target",              HC_GETTER(Event, target),               nullptr, v8::DontDelete, Config::kOnPrototype},
+        {"currentTarget",       HC_GETTER(Event, currentTarget),        nullptr, v8::DontDelete, Config::kOnPrototype},
+        {"defaultPrevented",    HC_GETTER(Event, DefaultPrevented),     nullptr, v8::DontDelete, Config::kOnPrototype},
+        {"data",                V8EventInternal::DataGetter,            nullptr, v8::DontDelete, Config::kOnPrototype},
 };
 
 static Config::MethodConfiguration methods[] = {
-        {"preventDefault", V8EventInternal::preventDefault, v8::DontDelete, Config::kOnPrototype, 0}
+        {"preventDefault", HC_METHOD(Event, PreventDefault), v8::DontDelete, Config::kOnPrototype, 0}
 };
 
 void V8Event::constructorCallback(const FunctionCallbackInfo<Value> &ci) {
@@ -89,9 +54,9 @@ void V8Event::constructorCallback(const FunctionCallbackInfo<Value> &ci) {
         return;
     }
 
-    // a better approach would be to have PerIsolate data, so that we can query for current
-    // constructor mode.
-    if ( Config::Status::CurrentConstructorMode == Config::ConstructorMode::kWrapExistingObject ) {
+    // wrapping an existing native object. It will be associated by the caller.
+    if ( Config::PerIsolateData::From(ci.GetIsolate())->CurrentConstructorMode() ==
+            Config::ConstructorMode::kWrapExistingObject ) {
         ci.GetReturnValue().Set( ci.Holder() );
         return;
     }
@@ -133,3 +98,9 @@ void V8Event::InstallInterfaceTemplate( Isolate* isolate, Local<FunctionTemplate
     Config::InstallMethods(isolate, instance_t, prototype_t, interface_template, signature, methods,
                         ARRAY_LENGTH(methods));
 }
+
+void V8Event::AppendExternalReferences(Config::ExternalReferenceTable& table) {
+    table.Append(wrapperTypeInfo.interface_name, "constructor", V8Event::constructorCallback);
+    Config::AppendExternalReferences(table, wrapperTypeInfo.interface_name, props, ARRAY_LENGTH(props));
+    Config::AppendExternalReferences(table, wrapperTypeInfo.interface_name, methods, ARRAY_LENGTH(methods));
+}
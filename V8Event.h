@@ -6,6 +6,7 @@
 #define HYPERCASINO_V8EVENT_H
 
 
+#include <vector>
 #include <v8.h>
 #include "Configuration.h"
 
@@ -39,6 +40,9 @@ public:
 
     static void constructorCallback(const FunctionCallbackInfo<Value> &);
 
+    // snapshot support. See Environment::ExternalReferences.
+    static void AppendExternalReferences(Config::ExternalReferenceTable &table);
+
     static const Config::WrapperTypeInfo wrapperTypeInfo;
 };
 
@@ -0,0 +1,127 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#include "V8EventTarget.h"
+#include "EventTarget.h"
+#include "Event.h"
+#include "Configuration.h"
+#include "PerIsolateData.h"
+#include "Bindings.h"
+
+namespace V8EventTargetInternal {
+
+    bool ListenerArguments(const FunctionCallbackInfo<Value> &info, EventTarget** target) {
+
+        *target = static_cast<EventTarget*>(Config::ToImpl<Wrappable>(info.Holder()));
+        if ( *target == nullptr ) {
+            Config::Throw(info.GetIsolate(), "Illegal invocation");
+            return false;
+        }
+
+        if ( info.Length() < 2 || !info[0]->IsString() ) {
+            Config::Throw(info.GetIsolate(), "Listener needs a type string and a function.");
+            return false;
+        }
+
+        // as in the dom, null listeners are ignored.
+        return info[1]->IsFunction();
+    }
+
+    void addEventListener(const FunctionCallbackInfo<Value> &info) {
+        EventTarget* target;
+        if ( ListenerArguments(info, &target) ) {
+            String::Utf8Value type(info[0]);
+            target->AddEventListener(info.GetIsolate(), *type, info[1].As<Function>());
+        }
+    }
+
+    void removeEventListener(const FunctionCallbackInfo<Value> &info) {
+        EventTarget* target;
+        if ( ListenerArguments(info, &target) ) {
+            String::Utf8Value type(info[0]);
+            target->RemoveEventListener(info.GetIsolate(), *type, info[1].As<Function>());
+        }
+    }
+
+    void dispatchEvent(const FunctionCallbackInfo<Value> &info) {
+
+        EventTarget* target = static_cast<EventTarget*>(Config::ToImpl<Wrappable>(info.Holder()));
+        Event* event = info.Length() > 0 ?
+                       Config::FromV8<Event*>::Convert(info.GetIsolate(), info[0]) :
+                       nullptr;
+
+        if ( target == nullptr || event == nullptr ) {
+            Config::Throw(info.GetIsolate(), "dispatchEvent needs an Event.");
+            return;
+        }
+
+        Isolate* isolate = info.GetIsolate();
+        info.GetReturnValue().Set(target->DispatchEvent(isolate, isolate->GetCurrentContext(), event));
+    }
+}
+
+const WrapperTypeInfo V8EventTarget::wrapperTypeInfo = {
+        V8EventTarget::InterfaceTemplate,
+        "EventTarget",
+        nullptr,
+        2,
+        HC_GARBAGE_COLLECTED_CLASS_ID,
+        Config::kEventTargetIndex,
+        EventTarget::Deserialize
+};
+
+const WrapperTypeInfo& EventTarget::wrapperTypeInfo_ = V8EventTarget::wrapperTypeInfo;
+
+static Config::MethodConfiguration methods[] = {
+        {"addEventListener",    V8EventTargetInternal::addEventListener,    v8::DontDelete, Config::kOnPrototype, 2},
+        {"removeEventListener", V8EventTargetInternal::removeEventListener, v8::DontDelete, Config::kOnPrototype, 2},
+        {"dispatchEvent",       V8EventTargetInternal::dispatchEvent,       v8::DontDelete, Config::kOnPrototype, 1},
+};
+
+void V8EventTarget::constructorCallback(const FunctionCallbackInfo<Value> &ci) {
+
+    if ( !ci.IsConstructCall() ) {
+        Config::Throw(ci.GetIsolate(), "Must be constructor");
+        return;
+    }
+
+    // wrapping an existing native object. It will be associated by the caller.
+    if ( Config::PerIsolateData::From(ci.GetIsolate())->CurrentConstructorMode() ==
+            Config::ConstructorMode::kWrapExistingObject ) {
+        ci.GetReturnValue().Set( ci.Holder() );
+        return;
+    }
+
+    EventTarget* target = new EventTarget();
+    v8::Local<v8::Object> wrapper = ci.Holder();
+    target->AssociateWithWrapper( ci.GetIsolate(), &V8EventTarget::wrapperTypeInfo, wrapper);
+
+    ci.GetReturnValue().Set(wrapper);
+}
+
+Local<FunctionTemplate> V8EventTarget::InterfaceTemplate(Isolate *isolate) {
+    return Config::InterfaceTemplate(isolate, wrapperTypeInfo, V8EventTarget::InstallInterfaceTemplate);
+}
+
+void V8EventTarget::InstallInterfaceTemplate( Isolate* isolate, Local<FunctionTemplate> interface_template ) {
+
+    Config::InitializeInterfaceTemplate(isolate, interface_template, wrapperTypeInfo );
+
+    // function template
+    interface_template->SetCallHandler(V8EventTarget::constructorCallback);
+    interface_template->SetLength(0);
+
+    v8::Local<v8::Signature> signature = v8::Signature::New(isolate, interface_template);
+
+    Local<ObjectTemplate> prototype_t = interface_template->PrototypeTemplate();
+    Local<ObjectTemplate> instance_t = interface_template->InstanceTemplate();
+
+    Config::InstallMethods(isolate, instance_t, prototype_t, interface_template, signature, methods,
+                        ARRAY_LENGTH(methods));
+}
+
+void V8EventTarget::AppendExternalReferences(Config::ExternalReferenceTable& table) {
+    table.Append(wrapperTypeInfo.interface_name, "constructor", V8EventTarget::constructorCallback);
+    Config::AppendExternalReferences(table, wrapperTypeInfo.interface_name, methods, ARRAY_LENGTH(methods));
+}
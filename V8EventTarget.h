@@ -0,0 +1,49 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_V8EVENTTARGET_H
+#define HYPERCASINO_V8EVENTTARGET_H
+
+
+#include <vector>
+#include <v8.h>
+#include "Configuration.h"
+
+using namespace v8;
+
+/**
+ * EventTarget bindings.
+ * Exposes addEventListener, removeEventListener and dispatchEvent.
+ */
+class V8EventTarget {
+public:
+
+    // This class must be static only
+    V8EventTarget() = delete;
+
+    V8EventTarget(const V8EventTarget &) = delete;
+
+    V8EventTarget &operator=(const V8EventTarget &) = delete;
+
+    void *operator new(size_t) = delete;
+
+    void *operator new(size_t, int, void *) = delete;
+
+    void *operator new(size_t, void *) = delete;
+
+    // V8 base.
+    static Local<FunctionTemplate> InterfaceTemplate(Isolate *);
+
+    static void
+    InstallInterfaceTemplate(Isolate *isolate, Local<FunctionTemplate> interface_template);
+
+    static void constructorCallback(const FunctionCallbackInfo<Value> &);
+
+    // snapshot support. See Environment::ExternalReferences.
+    static void AppendExternalReferences(Config::ExternalReferenceTable &table);
+
+    static const Config::WrapperTypeInfo wrapperTypeInfo;
+};
+
+#endif //HYPERCASINO_V8EVENTTARGET_H
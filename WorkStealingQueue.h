@@ -0,0 +1,63 @@
+//
+// Created by hyperandroid on 17/10/2026.
+//
+
+#ifndef HYPERCASINO_WORKSTEALINGQUEUE_H
+#define HYPERCASINO_WORKSTEALINGQUEUE_H
+
+#include <deque>
+#include <mutex>
+
+/**
+ * Per worker job queue. The owner pushes and pops at the back, so it keeps working on what it
+ * touched last. Idle workers steal from the front, the oldest job.
+ * Each queue has its own lock, so workers only contend when stealing from the same victim.
+ */
+template<typename T>
+class WorkStealingQueue {
+public:
+
+    WorkStealingQueue() = default;
+
+    WorkStealingQueue(const WorkStealingQueue&) = delete;
+    WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+    void Push(T value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        items_.push_back(std::move(value));
+    }
+
+    // owner side.
+    bool Pop(T* value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (items_.empty()) {
+            return false;
+        }
+        *value = std::move(items_.back());
+        items_.pop_back();
+        return true;
+    }
+
+    // thief side.
+    bool Steal(T* value) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (items_.empty()) {
+            return false;
+        }
+        *value = std::move(items_.front());
+        items_.pop_front();
+        return true;
+    }
+
+    size_t Size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return items_.size();
+    }
+
+private:
+
+    mutable std::mutex mutex_;
+    std::deque<T> items_;
+};
+
+#endif //HYPERCASINO_WORKSTEALINGQUEUE_H
@@ -4,6 +4,7 @@
 
 #include "Wrappable.h"
 #include "Configuration.h"
+#include "PerIsolateData.h"
 
 Wrappable::~Wrappable() {
     if (ContainsWrapper()) {
@@ -23,21 +24,48 @@ v8::Local<v8::Object> Wrappable::Wrap(
     const WrapperTypeInfo *wrapper_type_info = GetWrapperTypeInfo();
 
     // wrapping means we are wrapping an existing object.
-    // bugbug: use RAII. this just for demo purposes.
-    Config::ConstructorMode prevConstructorMode = Config::Status::CurrentConstructorMode;
-    Config::Status::CurrentConstructorMode = Config::kWrapExistingObject;
+    // the wrapper is cloned from a per type boilerplate, so the js constructor does not run.
+    v8::Local<v8::Object> wrapper = Config::NewWrapperInstance(
+            isolate,
+            creation_context,
+            *wrapper_type_info);
 
-    // create a cache of boilerplate objects and Clone ??
-    v8::Local<v8::Object> wrapper = wrapper_type_info->
-            template_function(isolate)->
-            GetFunction()->
-            NewInstance(creation_context).ToLocalChecked();
+    return AssociateWithWrapper(isolate, wrapper_type_info, wrapper);
+}
+
+v8::Local<v8::Array> Wrappable::WrapAll(
+        v8::Isolate *isolate,
+        v8::Local<v8::Context> creation_context,
+        Wrappable *const *wrappables,
+        size_t count) {
+
+    v8::EscapableHandleScope scope(isolate);
+
+    v8::Local<v8::Array> wrappers = v8::Array::New(isolate, static_cast<int>(count));
 
-    auto ret = AssociateWithWrapper(isolate, wrapper_type_info, wrapper);
+    const WrapperTypeInfo *boilerplate_type_info = nullptr;
+    v8::Local<v8::Object> boilerplate;
 
-    Config::Status::CurrentConstructorMode = prevConstructorMode;
+    for (size_t i = 0; i < count; i++) {
+        Wrappable *wrappable = wrappables[i];
+        v8::Local<v8::Object> wrapper;
+
+        if (wrappable->ContainsWrapper()) {
+            wrapper = wrappable->GetWrapper(isolate);
+        } else {
+            const WrapperTypeInfo *wrapper_type_info = wrappable->GetWrapperTypeInfo();
+            if (wrapper_type_info != boilerplate_type_info) {
+                boilerplate = Config::WrapperBoilerplate(isolate, creation_context, *wrapper_type_info);
+                boilerplate_type_info = wrapper_type_info;
+            }
+
+            wrapper = wrappable->AssociateWithWrapper(isolate, wrapper_type_info, boilerplate->Clone());
+        }
+
+        wrappers->Set(creation_context, static_cast<uint32_t>(i), wrapper).FromJust();
+    }
 
-    return ret;
+    return scope.Escape(wrappers);
 }
 
 v8::Local<v8::Object> Wrappable::AssociateWithWrapper(
@@ -65,8 +93,31 @@ void Wrappable::SetNativeInfo(const WrapperTypeInfo *wrapper_type_info,
 
 }
 
-static void weakCallbackForDOMObjectHolder(const v8::WeakCallbackInfo<Wrappable> &data) {
-    delete data.GetParameter();
+void Wrappable::OnWrapperCollected(const v8::WeakCallbackInfo<Wrappable> &data) {
+    Wrappable *wrappable = data.GetParameter();
+
+    PerIsolateData *isolateData = PerIsolateData::From(data.GetIsolate());
+    if (isolateData != nullptr) {
+        isolateData->ExternalMemoryAccounting().Adjust(
+                *wrappable->GetWrapperTypeInfo(),
+                -static_cast<int64_t>(wrappable->accountedSize_),
+                -1);
+    }
+
+    delete wrappable;
+}
+
+void Wrappable::UpdateNativeSize(v8::Isolate *isolate) {
+    size_t size = NativeSize();
+    if (!ContainsWrapper() || size == accountedSize_) {
+        return;
+    }
+
+    PerIsolateData::From(isolate)->ExternalMemoryAccounting().Adjust(
+            *GetWrapperTypeInfo(),
+            static_cast<int64_t>(size) - static_cast<int64_t>(accountedSize_),
+            0);
+    accountedSize_ = size;
 }
 
 bool Wrappable::SetWrapper(v8::Isolate *isolate,
@@ -84,8 +135,15 @@ bool Wrappable::SetWrapper(v8::Isolate *isolate,
     // basic GC management.
     wrapper_.SetWeak(
             this,
-            weakCallbackForDOMObjectHolder,
+            OnWrapperCollected,
             v8::WeakCallbackType::kParameter);
 
+    // native memory is accounted for as long as the wrapper lives.
+    accountedSize_ = NativeSize();
+    PerIsolateData::From(isolate)->ExternalMemoryAccounting().Adjust(
+            *wrapper_type_info,
+            static_cast<int64_t>(accountedSize_),
+            1);
+
     return true;
 }
\ No newline at end of file
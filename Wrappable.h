@@ -5,16 +5,19 @@
 #ifndef HYPERCASINO_WRAPPABLE_H
 #define HYPERCASINO_WRAPPABLE_H
 
+#include <string>
 #include <v8.h>
 #include "Configuration.h"
 
+class HeapTracer;
+
 using namespace Config;
 
 class Wrappable {
 
 public:
 
-    Wrappable() {};
+    Wrappable() : accountedSize_(0) {};
 
     virtual ~Wrappable();
 
@@ -23,6 +26,17 @@ public:
     virtual v8::Local<v8::Object> Wrap(v8::Isolate *,
                                        v8::Local<v8::Context> creation_context);
 
+    /**
+     * Wrap a burst of native objects at once, and return their wrappers in a js Array, in the
+     * same order. Objects already wrapped keep their wrapper.
+     * Uses a single handle scope, and a single boilerplate lookup for each run of objects of the
+     * same type.
+     */
+    static v8::Local<v8::Array> WrapAll(v8::Isolate *,
+                                        v8::Local<v8::Context> creation_context,
+                                        Wrappable *const *wrappables,
+                                        size_t count);
+
     virtual v8::Local<v8::Object> AssociateWithWrapper(
             v8::Isolate *,
             const WrapperTypeInfo *,
@@ -45,6 +59,60 @@ public:
         return wrapper_.Get(isolate);
     }
 
+    /**
+     * Startup snapshot support. Write the state this type's WrapperTypeInfo::deserialize needs
+     * to rebuild the native object. Called while v8 serializes the heap: no v8 calls allowed.
+     */
+    virtual void SerializeInternalFields(std::string &state) const {}
+
+    /**
+     * Snapshot support. Called before the heap is serialized, while v8 calls are still allowed.
+     * State held in v8 handles must be moved into the wrapper and the handles released, since
+     * the serializer refuses live global handles.
+     */
+    virtual void PrepareForSnapshot(v8::Isolate *isolate) {}
+
+    /**
+     * Forget the wrapper without deleting this object. Snapshot support only: the wrapper's
+     * internal fields still point to this object while the heap is serialized.
+     */
+    void ClearWrapper() { wrapper_.Reset(); }
+
+    /**
+     * Report native references to other Wrappables with tracer->Trace, so that their wrappers
+     * are kept alive while this object is. Called during GC marking: no v8 calls allowed.
+     */
+    virtual void Trace(HeapTracer *tracer) const {}
+
+    /**
+     * Mark this object's wrapper as reachable. Called by HeapTracer.
+     */
+    void TraceWrapper(v8::Isolate *isolate) const {
+        if (ContainsWrapper()) {
+            wrapper_.RegisterExternalReference(isolate);
+        }
+    }
+
+    /**
+     * Keep this object's wrapper through the next scavenge. Called by HeapTracer.
+     */
+    void MarkWrapperActive() const {
+        if (ContainsWrapper()) {
+            const_cast<v8::Persistent<v8::Object>&>(wrapper_).MarkActive();
+        }
+    }
+
+    /**
+     * Bytes of native memory this object owns, like buffers, that v8 should know about.
+     * Accounted when the object is wrapped, and given back when the wrapper is collected.
+     */
+    virtual size_t NativeSize() const { return 0; }
+
+    /**
+     * Account a NativeSize change of an already wrapped object.
+     */
+    void UpdateNativeSize(v8::Isolate *isolate);
+
     void SetWrapperClassId( uint16_t type ) {
         wrapper_.SetWrapperClassId(type);
     }
@@ -53,13 +121,22 @@ protected:
 
 private:
 
+    static void OnWrapperCollected(const v8::WeakCallbackInfo<Wrappable> &data);
+
     v8::Persistent<v8::Object> wrapper_;
+
+    // NativeSize as last accounted.
+    size_t accountedSize_;
 };
 
 #define DEFINE_WRAPPERTYPEINFO()                                        \
+    public:                                                             \
         const WrapperTypeInfo* GetWrapperTypeInfo() const override {    \
             return &wrapperTypeInfo_;                                   \
         }                                                               \
+        static const WrapperTypeInfo* GetStaticWrapperTypeInfo() {      \
+            return &wrapperTypeInfo_;                                   \
+        }                                                               \
     private:                                                            \
         static const WrapperTypeInfo& wrapperTypeInfo_
 
@@ -1,8 +1,24 @@
 #include <main.h>
+#include <thread>
+#include <chrono>
 #include <v8-version-string.h>
-#include <libplatform/libplatform.h>
 #include "V8Event.h"
+#include "V8EventTarget.h"
 #include "Event.h"
+#include "Benchmarks.h"
+#include "PerIsolateData.h"
+#include "EventTarget.h"
+#include "EventQueue.h"
+#include "CodeCache.h"
+#include "Environment.h"
+#include "Snapshot.h"
+#include "StreamingScriptLoader.h"
+#include "MappedScriptSource.h"
+#include "IsolatePool.h"
+#include "TaskPlatform.h"
+#include "ModuleLoader.h"
+#include "ContextPool.h"
+#include "PoolingArrayBufferAllocator.h"
 
 using namespace v8;
 
@@ -21,9 +37,62 @@ namespace v8 {
     }
 }
 
+static TaskPlatform* platform_;
+
+/**
+ * Backing stores for the main isolate's ArrayBuffers. Typed arrays are pooled by size class.
+ */
+static Config::PoolingArrayBufferAllocator* arrayBufferAllocator_;
 static Isolate* isolate_;
 static Persistent<Context> context_;
 
+/**
+ * Events produced on other threads. Drained on the isolate thread and dispatched to
+ * `nativeEvents` in javascript.
+ */
+static EventQueue eventQueue_;
+static EventTarget* nativeEvents_;
+
+/**
+ * ES modules for context_. Bindings are importable from 'hypercasino'.
+ */
+static ModuleLoader* modules_;
+
+/**
+ * Fresh contexts for short lived script sessions.
+ */
+static ContextPool* sessions_;
+
+/**
+ * Compiled code for runScript sources, persisted across runs.
+ */
+static CodeCache codeCache_("/data/data/com.socialgames.v8tutorial/cache");
+
+/**
+ * Application bootstrap. With a startup snapshot these run once, when the snapshot is created,
+ * and every later context starts with their result.
+ */
+static const char* const kInitScripts[] = {
+        "this.app = { events: new EventTarget(), boot: new Event('boot'), received: [] };"
+        "app.events.addEventListener('ready', function(e) { app.received.push(e.type); });"
+        "app.boot.preventDefault();"
+};
+static const size_t kInitScriptCount = sizeof(kInitScripts) / sizeof(kInitScripts[0]);
+
+#ifdef HC_STARTUP_SNAPSHOT
+/**
+ * Startup snapshot with the bindings and the bootstrapped app. Created on first launch.
+ * Must outlive the isolate.
+ */
+static const char* const kSnapshotPath = "/data/data/com.socialgames.v8tutorial/cache/startup.snapshot";
+static StartupData snapshotBlob_;
+#endif
+
+static double nowMillis() {
+    return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 jint JNI_OnLoad(JavaVM* vm, void* reserved)
 {
     LOGV("JNI OnLoad called");
@@ -39,34 +108,148 @@ jint JNI_OnLoad(JavaVM* vm, void* reserved)
 }
 
 
-void log( const v8::FunctionCallbackInfo<Value>& info ) {
+void drainNativeEvents() {
+    v8::HandleScope scope(isolate_);
+    v8::Local<v8::Context> context = context_.Get( isolate_ );
+    v8::Context::Scope context_scope(context);
+
+    eventQueue_.Drain(isolate_, context, nativeEvents_, 256);
 
-    // naive implementation
-    v8::String::Utf8Value utf(info[0].As<v8::String>());
-    LOGV("%s", *utf );
+    EventQueue::Statistics stats = eventQueue_.GetStatistics();
+    LOGV("native events: %llu drained, depth %zu, last drain %.3fms, max latency %.3fms",
+         (unsigned long long) stats.drained, stats.depth, stats.last_drain_ms, stats.max_latency_ms);
 }
 
-void nativeFactory( const v8::FunctionCallbackInfo<Value>& info ) {
+/**
+ * Microtask time budget per host tick.
+ */
+static const double kMicrotaskBudgetMs = 4.0;
 
-    HandleScope hs( info.GetIsolate() );
+/**
+ * Heap statistics are sampled from the host tick at most this often.
+ */
+static const double kHeapSampleIntervalMs = 1000.0;
 
-    Event *ev = new Event("factory");
+void drainMicrotasks() {
+    v8::HandleScope scope(isolate_);
+    v8::Context::Scope context_scope(context_.Get( isolate_ ));
 
-    struct timespec __now;
-    clock_gettime(CLOCK_MONOTONIC_RAW, &__now);
-    ev->timeStamp = __now.tv_sec;
+    Config::MicrotaskScheduler& microtasks = Config::PerIsolateData::From(isolate_)->Microtasks();
+    microtasks.Drain();
 
-    Local<Object> new_js_event = ev->Wrap( isolate_, context_.Get(isolate_) );
-    info.GetReturnValue().Set( new_js_event );
+    Config::MicrotaskScheduler::Statistics stats = microtasks.GetStatistics();
+    LOGV("microtasks: drained in %.3fms, %llu of %llu drains over budget",
+         stats.last_drain_ms, (unsigned long long) stats.over_budget, (unsigned long long) stats.drains);
 }
 
 void initializeV8() {
-    // 666: leaking platform.
-    Platform *platform = v8::platform::CreateDefaultPlatform();
-    V8::InitializePlatform(platform);
+    // background workers on every core but the isolate thread's.
+    platform_ = new TaskPlatform();
+    V8::InitializePlatform(platform_);
     V8::Initialize();
 }
 
+/**
+ * Run v8's pending foreground tasks (GC finalization, delayed tasks) on the isolate thread.
+ */
+void pumpMessageLoop() {
+    platform_->PumpMessageLoop(isolate_);
+}
+
+void logPlatformStatistics() {
+    for (int kind = 0; kind < TaskPlatform::kTaskKindCount; kind++) {
+        TaskPlatform::TaskStatistics stats = platform_->GetStatistics(static_cast<TaskPlatform::TaskKind>(kind));
+        LOGV("platform %s tasks: %llu posted, %llu run in %.3fms (max %.3fms), %.3fms waiting",
+             TaskPlatform::TaskKindName(static_cast<TaskPlatform::TaskKind>(kind)),
+             (unsigned long long) stats.posted, (unsigned long long) stats.executed,
+             stats.total_run_ms, stats.max_run_ms, stats.total_wait_ms);
+    }
+}
+
+/**
+ * One host tick: native events, then the promise continuations they and previous scripts
+ * queued, then v8's own foreground tasks.
+ */
+void hostTick() {
+    drainNativeEvents();
+    drainMicrotasks();
+    pumpMessageLoop();
+    sessions_->Refill();
+
+    Config::PerIsolateData* isolateData = Config::PerIsolateData::From(isolate_);
+    isolateData->ExternalMemoryAccounting().Flush();
+    isolateData->Metrics().MaybeSample();
+}
+
+void logArrayBufferStatistics() {
+    Config::ArrayBufferStatistics stats = arrayBufferAllocator_->Statistics();
+    LOGV("array buffers: %zu bytes live, %zu high water, %zu cached, %llu allocations, %llu reused, %llu rejected",
+         stats.live_bytes, stats.high_water_bytes, stats.cached_bytes, (unsigned long long) stats.allocations,
+         (unsigned long long) stats.reused, (unsigned long long) stats.rejected);
+
+    for (const Config::SizeClassStatistics& sizeClass : stats.size_classes) {
+        if (sizeClass.live_blocks != 0 || sizeClass.cached_blocks != 0) {
+            LOGV("array buffers %zu: %zu live (%zu bytes), %zu cached",
+                 sizeClass.block_size, sizeClass.live_blocks, sizeClass.live_bytes, sizeClass.cached_blocks);
+        }
+    }
+}
+
+void logGcMetrics() {
+    Config::GcMetrics& metrics = Config::PerIsolateData::From(isolate_)->Metrics();
+    for (int kind = 0; kind < Config::GcMetrics::kGcKindCount; kind++) {
+        const Config::GcMetrics::PauseStatistics& pauses = metrics.Pauses(static_cast<Config::GcMetrics::GcKind>(kind));
+        LOGV("gc %s: %llu pauses, %.3fms total, %.3fms max",
+             Config::GcMetrics::GcKindName(static_cast<Config::GcMetrics::GcKind>(kind)),
+             (unsigned long long) pauses.count, pauses.total_ms, pauses.max_ms);
+    }
+}
+
+void logExternalMemory() {
+    std::vector<Config::ExternalMemoryStatistics> statistics;
+    Config::ExternalMemory& externalMemory = Config::PerIsolateData::From(isolate_)->ExternalMemoryAccounting();
+    externalMemory.GetStatistics(statistics);
+
+    for (const Config::ExternalMemoryStatistics& type : statistics) {
+        LOGV("external memory %s: %lld objects, %lld bytes",
+             type.interface_name, (long long) type.objects, (long long) type.bytes);
+    }
+    LOGV("external memory reported to v8: %lld bytes", (long long) externalMemory.Reported());
+}
+
+/**
+ * Tear down in reverse order: isolate, v8, then the platform, which joins its workers.
+ */
+void disposeV8() {
+    delete modules_;
+    modules_ = nullptr;
+    delete sessions_;
+    sessions_ = nullptr;
+    context_.Reset();
+    Config::PerIsolateData::Dispose(isolate_);
+
+    // entered in RunV8Stuff.
+    isolate_->Exit();
+    platform_->UnregisterIsolate(isolate_);
+    isolate_->Dispose();
+    isolate_ = nullptr;
+
+    delete arrayBufferAllocator_;
+    arrayBufferAllocator_ = nullptr;
+
+    V8::Dispose();
+    V8::ShutdownPlatform();
+
+    logPlatformStatistics();
+    delete platform_;
+    platform_ = nullptr;
+
+#ifdef HC_STARTUP_SNAPSHOT
+    delete[] snapshotBlob_.data;
+    snapshotBlob_ = {nullptr, 0};
+#endif
+}
+
 
 void runScript(const char* cscript ) {
 
@@ -77,8 +260,10 @@ void runScript(const char* cscript ) {
     //
     v8::Local<v8::String> source;
     source = v8::String::NewFromUtf8(isolate_, cscript);
+    // one-off sources bypass the isolate's ScriptCache, so they don't evict library scripts.
     v8::ScriptOrigin origin(v8::String::NewFromUtf8(isolate_, "test"));
-    v8::MaybeLocal<v8::Script> maybescript = v8::Script::Compile(context, source, &origin);
+    v8::MaybeLocal<v8::Script> maybescript = codeCache_.Compile(
+            context, source, origin, CodeCache::Hash(cscript, strlen(cscript)));
     if (maybescript.IsEmpty()) {
         return;
     }
@@ -94,47 +279,167 @@ void runScript(const char* cscript ) {
     }
 }
 
+/**
+ * Run a script file, parsed on a worker thread while it is read.
+ * For large bundles, where the parse would otherwise stall the isolate thread.
+ */
+void runScriptFile(const char* path) {
+
+    v8::HandleScope scope(isolate_);
+    v8::Local<v8::Context> context = context_.Get( isolate_ );
+    v8::Context::Scope context_scope(context);
+
+    StreamingScriptLoader loader(isolate_);
+    if (!loader.Start(path)) {
+        LOGV("can't stream script %s", path);
+        return;
+    }
+
+    // the isolate thread is free here until Finish.
+
+    v8::Local<v8::Script> script;
+    if (loader.Finish(context).ToLocal(&script)) {
+        StreamingScriptLoader::Statistics stats = loader.GetStatistics();
+        LOGV("streamed %s: %zu bytes, %.3fms parse on worker, %.3fms wait, %.3fms compile",
+             path, stats.bytes, stats.stream_ms, stats.wait_ms, stats.compile_ms);
+
+        v8::Local<v8::Value> result;
+        if (!script->Run(context).ToLocal(&result)) {
+            // catched by isolate handlers.
+        }
+    }
+}
+
+/**
+ * Run a script file without copying its source onto the heap. The file is memory mapped and
+ * handed to v8 as an external string.
+ */
+void runMappedScript(const char* path) {
+
+    v8::HandleScope scope(isolate_);
+    v8::Local<v8::Context> context = context_.Get( isolate_ );
+    v8::Context::Scope context_scope(context);
+
+    uint64_t hash;
+    v8::Local<v8::String> source;
+    if (!MappedScriptSource::Load(isolate_, path, &hash).ToLocal(&source)) {
+        LOGV("can't map script %s", path);
+        return;
+    }
+
+    v8::Local<v8::Script> script;
+    if (Config::PerIsolateData::From(isolate_)->Scripts().Bind(context, path, source, hash).ToLocal(&script)) {
+        if (script->Run(context).IsEmpty()) {
+            // catched by isolate handlers.
+        }
+    }
+}
+
+/**
+ * Import an ES module file, and everything it imports.
+ */
+void importModule(const char* path) {
+
+    v8::HandleScope scope(isolate_);
+    v8::Local<v8::Context> context = context_.Get( isolate_ );
+    v8::Context::Scope context_scope(context);
+
+    v8::TryCatch try_catch(isolate_);
+    v8::Local<v8::Object> ns;
+    if (!modules_->Import(path).ToLocal(&ns)) {
+        v8::String::Utf8Value error(isolate_, try_catch.Exception());
+        LOGV("module %s failed: %s", path, *error != nullptr ? *error : "");
+        return;
+    }
+
+    ModuleLoader::Statistics stats = modules_->GetStatistics();
+    LOGV("module %s: %zu modules, %llu compiled, %llu reused", path, stats.modules,
+         (unsigned long long) stats.compiled, (unsigned long long) stats.reused);
+}
+
 void RunV8Stuff() {
+    double start = nowMillis();
+    bool fromSnapshot = false;
+
+    Config::PoolingArrayBufferAllocator::Options allocatorOptions;
+    allocatorOptions.max_live_bytes = 256 * 1024 * 1024;
+    arrayBufferAllocator_ = new Config::PoolingArrayBufferAllocator(allocatorOptions);
+
     v8::Isolate::CreateParams params;
-    params.array_buffer_allocator = v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+    params.array_buffer_allocator = arrayBufferAllocator_;
+
+#ifdef HC_STARTUP_SNAPSHOT
+    snapshotBlob_ = Snapshot::LoadOrCreateBlob(kSnapshotPath, kInitScripts, kInitScriptCount);
+    if (snapshotBlob_.data != nullptr) {
+        params.snapshot_blob = &snapshotBlob_;
+        params.external_references = Environment::ExternalReferences();
+        fromSnapshot = true;
+    } else {
+        LOGV("startup snapshot unavailable, bootstrapping from scripts.");
+    }
+#endif
+
     isolate_ = v8::Isolate::New(params);
     isolate_->Enter();
 
+    Config::PerIsolateData* isolateData = Config::PerIsolateData::Initialize(isolate_);
+    isolateData->Scripts().SetCodeCache(&codeCache_);
+    isolateData->Microtasks().Enable(kMicrotaskBudgetMs);
+    isolateData->EnableHeapTracing();
+    isolateData->Metrics().Enable(kHeapSampleIntervalMs);
+
     v8::Isolate::Scope isolatescope(isolate_);
     v8::HandleScope scope(isolate_);
 
-    v8::Eternal<v8::FunctionTemplate> v8EventConstructor(isolate_,
-                                                         V8Event::InterfaceTemplate(isolate_));
+    v8::Local<v8::Context> context;
+    if (fromSnapshot) {
+        /**
+         * templates, context and the bootstrapped app are deserialized from the snapshot.
+         * No setup code runs.
+         */
+        Snapshot::RestoreTemplates(isolate_);
+        context = Snapshot::NewContext(isolate_);
+    } else {
+        // the isolate's global object template, shared with every other context.
+        auto global_template = Environment::GlobalTemplate(isolate_);
+
+        /**
+         * create a context with the global context template. Our Event object is there as a
+         * constructor function.
+         */
+        context = v8::Context::New(isolate_, nullptr, global_template);
+    }
+    context_.Reset(isolate_, context);
 
-    // Create a gloal object template
-    auto global_template = v8::ObjectTemplate::New(isolate_);
+    sessions_ = new ContextPool(isolate_, 4, fromSnapshot ? Snapshot::NewContext : nullptr);
 
-    global_template->Set(
-            v8::String::NewFromUtf8(isolate_, "log"),
-            v8::FunctionTemplate::New(isolate_, log)
-    );
+    modules_ = new ModuleLoader(isolate_, context);
+    modules_->RegisterNativeModule("hypercasino", {"Event", "EventTarget", "log"});
 
-    global_template->Set(
-            v8::String::NewFromUtf8(isolate_, "nativeFactory"),
-            v8::FunctionTemplate::New(isolate_, nativeFactory)
-    );
+    if (!fromSnapshot) {
+        for (size_t i = 0; i < kInitScriptCount; i++) {
+            runScript(kInitScripts[i]);
+        }
+    }
 
-    global_template->Set(
-            v8::String::NewFromUtf8(isolate_, "Event"),
-            v8EventConstructor.Get(isolate_));
+    nativeEvents_ = new EventTarget();
+    context->Global()->Set(
+            context,
+            v8::String::NewFromUtf8(isolate_, "nativeEvents"),
+            nativeEvents_->Wrap(isolate_, context)).FromJust();
 
-    /**
-     * create a context with the global context template. Our Event object is there as a
-     * constructor function.
-     */
-    v8::Local<v8::Context> context = v8::Context::New(isolate_, nullptr, global_template);
-    context_.Reset(isolate_, context);
+    LOGV("time to first script: %.3fms (%s)", nowMillis() - start, fromSnapshot ? "snapshot" : "scripts");
 
     /**
      * Enumerate our global object.
      */
     runScript( "log('context properties enumeration:'); for(var i in this) {log(i);}; ");
 
+    /**
+     * app state, either bootstrapped or restored from the snapshot.
+     */
+    runScript( "log('app'); log(app.boot.type); log(app.boot.defaultPrevented); app.events.dispatchEvent(new Event('ready')); log(app.received.length);");
+
     /**
      * Enumerate properties in fresh Event object created from javascript.
      */
@@ -152,6 +457,131 @@ void RunV8Stuff() {
      */
     runScript( "log('create from native'); var ev2 = nativeFactory(); log(ev2.timeStamp); log(ev2.type);");
 
+    /**
+     * native EventTarget. Listeners run from a single native dispatch loop.
+     */
+    runScript( "log('event target'); var et = new EventTarget(); et.addEventListener('ping', function(e) { log(e.type); log(e.target === et); e.preventDefault(); }); log(et.dispatchEvent(new Event('ping')));");
+
+    /**
+     * events produced on another thread, and dispatched in a single drain.
+     */
+    runScript( "nativeEvents.addEventListener('sensor', function(e) { log('sensor event ' + e.timeStamp); });");
+    std::thread producer([]() {
+        for (int i = 0; i < 3; i++) {
+            Event* ev = new Event("sensor");
+            ev->timeStamp = i;
+            eventQueue_.Push(ev);
+        }
+    });
+    producer.join();
+
+    /**
+     * promise continuations wait for the host tick, after the script that queued them.
+     */
+    runScript( "Promise.resolve('continuation').then(function(v) { log(v); }); log('script end');");
+
+    hostTick();
+
+    /**
+     * application bundle, if deployed.
+     */
+    runScriptFile("/data/data/com.socialgames.v8tutorial/files/bundle.js");
+    runMappedScript("/data/data/com.socialgames.v8tutorial/files/library.js");
+
+    /**
+     * modules. Native bindings and files, each compiled once however often imported.
+     */
+    importModule("hypercasino");
+    importModule("hypercasino");
+    importModule("/data/data/com.socialgames.v8tutorial/files/main.mjs");
+
+    /**
+     * short lived contexts running the same library code. It compiles once, and every context
+     * only binds it.
+     */
+    for (int i = 0; i < 3; i++) {
+        v8::HandleScope hs(isolate_);
+        v8::Local<v8::Context> scratch = v8::Context::New(isolate_, nullptr, Environment::GlobalTemplate(isolate_));
+        const char* library = "function sum(a, b) { return a + b; } sum(1, 2);";
+        v8::Local<v8::Script> script;
+        if (Config::PerIsolateData::From(isolate_)->Scripts().Bind(
+                scratch, "library", v8::String::NewFromUtf8(isolate_, library),
+                CodeCache::Hash(library, strlen(library))).ToLocal(&script)) {
+            v8::Context::Scope scratch_scope(scratch);
+            if (script->Run(scratch).IsEmpty()) {
+                // catched by isolate handlers.
+            }
+        }
+    }
+
+    /**
+     * scripts in parallel, each worker with its own isolate and bindings.
+     */
+    {
+        IsolatePool pool(2, platform_);
+        std::future<IsolatePool::Result> first = pool.Run("pool", "new Event('pooled').type");
+        std::future<IsolatePool::Result> second = pool.Run("pool", "throw new Error('pooled failure')");
+        IsolatePool::Result result = first.get();
+        LOGV("isolate pool: %s %s", result.succeeded ? "ok" : "failed", result.value.c_str());
+        result = second.get();
+        LOGV("isolate pool: %s %s", result.succeeded ? "ok" : "failed", result.value.c_str());
+    }
+
+    /**
+     * sessions, each in fresh globals.
+     */
+    for (int i = 0; i < 8; i++) {
+        v8::HandleScope hs(isolate_);
+        v8::Local<v8::Context> session = sessions_->Acquire();
+        {
+            v8::Context::Scope session_scope(session);
+            v8::Local<v8::Script> script;
+            if (v8::Script::Compile(session, v8::String::NewFromUtf8(isolate_, "this.session = (this.session || 0) + 1;")).ToLocal(&script) &&
+                    script->Run(session).IsEmpty()) {
+                // catched by isolate handlers.
+            }
+        }
+        sessions_->Release(session);
+    }
+
+    ContextPool::Statistics sessionStats = sessions_->GetStatistics();
+    LOGV("context pool: %llu acquired, %llu misses, %llu created, acquire p50 %.3fms p99 %.3fms",
+         (unsigned long long) sessionStats.acquired, (unsigned long long) sessionStats.misses,
+         (unsigned long long) sessionStats.created, sessionStats.p50_acquire_ms, sessionStats.p99_acquire_ms);
+
+    Config::ScriptCache::Statistics scriptStats = Config::PerIsolateData::From(isolate_)->Scripts().GetStatistics();
+    LOGV("script cache: %llu hits, %llu misses, %llu evictions, %zu scripts",
+         (unsigned long long) scriptStats.hits, (unsigned long long) scriptStats.misses,
+         (unsigned long long) scriptStats.evictions, scriptStats.entries);
+
+    CodeCache::Statistics cacheStats = codeCache_.GetStatistics();
+    LOGV("code cache: %llu hits in %.3fms, %llu misses and %llu rejected in %.3fms",
+         (unsigned long long) cacheStats.hits, cacheStats.hit_compile_ms,
+         (unsigned long long) cacheStats.misses, (unsigned long long) cacheStats.rejected,
+         cacheStats.miss_compile_ms);
+
+    hostTick();
+
+#ifdef HC_BENCHMARKS
+    Benchmarks::Run(isolate_, context);
+#endif
+
+    /**
+     * GC and heap statistics, as seen from script.
+     */
+    runScript( "var s = stats(); log('gc scavenges ' + s.gc.scavenge.count + ', max pause ' + s.gc.scavenge.maxMs + 'ms'); log('heap used ' + s.heap.usedHeapSize + ' of ' + s.heap.heapSizeLimit);");
+
+    logExternalMemory();
+    logGcMetrics();
+    logArrayBufferStatistics();
+
+    HeapTracer::Statistics traceStats = isolateData->Tracer().GetStatistics();
+    LOGV("heap tracer: %llu traces, %zu wrappables in the last one, in %.3fms. %llu scavenges, last marked in %.3fms",
+         (unsigned long long) traceStats.traces, traceStats.last_wrappables, traceStats.last_trace_ms,
+         (unsigned long long) traceStats.scavenges, traceStats.last_scavenge_ms);
+
+    logPlatformStatistics();
+
 }
 
 extern "C" {
@@ -179,5 +609,10 @@ Java_com_socialgames_v8tutorial_SocialGames_InitializeV8(JNIEnv *env, jobject ob
     RunV8Stuff();
 }
 
+JNIEXPORT void JNICALL
+Java_com_socialgames_v8tutorial_SocialGames_DisposeV8(JNIEnv *env, jobject obj) {
+    disposeV8();
+}
+
 }
 